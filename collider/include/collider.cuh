@@ -23,21 +23,45 @@ namespace manifold {
 class Collider {
  public:
   Collider() {}
-  Collider(const VecDH<Box>& leafBB, const VecDH<uint32_t>& leafMorton);
+  // Morton codes may be either uint32_t or uint64_t.
+  template <typename T>
+  Collider(const VecDH<Box>& leafBB, const VecDH<T>& leafMorton);
+  // The leaves are a sorted permutation of the items, so leafMorton is sorted,
+  // while itemBB and the returned collisions are indexed by item.
+  template <typename T>
+  Collider(const VecDH<Box>& itemBB, const VecDH<T>& leafMorton,
+           const VecDH<int>& leafIndex);
   // Aborts and returns false if transform is not axis aligned.
   bool Transform(glm::mat4x3);
-  void UpdateBoxes(const VecDH<Box>& leafBB);
+  // Refits the existing hierarchy, returning false if it has degraded enough
+  // that it should be rebuilt.
+  bool UpdateBoxes(const VecDH<Box>& leafBB);
+  // Adds the new items, given in Morton order, as a subtree of their own and
+  // refits, where removed items have empty boxes. Returns false if the
+  // hierarchy should be rebuilt instead.
+  template <typename T>
+  bool Graft(const VecDH<Box>& itemBB, const VecDH<int>& newItems,
+             const VecDH<T>& newMorton);
   // Collisions returns a sparse result, where i is the querry index and j is
   // the leaf index where their bounding boxes overlap.
   template <typename T>
   SparseIndices Collisions(const VecDH<T>& querriesIn) const;
+  void Serialize(std::ostream&) const;
+  void Deserialize(std::istream&, int numItems);
 
  private:
   VecDH<Box> nodeBBox_;
   VecDH<int> nodeParent_;
   // even nodes are leaves, odd nodes are internal, root is 1
   VecDH<thrust::pair<int, int>> internalChildren_;
+  // item index of each leaf, or empty if they are the same
+  VecDH<int> leafIndex_;
+  // surface area heuristic cost of the hierarchy when it was built
+  float buildCost_ = 0;
+  // upper bound on the depth of the hierarchy, which grows with each graft
+  int maxDepth_ = 0;
 
+  float Cost() const;
   int NumInternal() const { return internalChildren_.size(); };
   int NumLeaves() const { return NumInternal() + 1; };
 };
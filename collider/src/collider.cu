@@ -12,12 +12,23 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thrust/count.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "collider.cuh"
 #include "utils.cuh"
 
 // Adjustable parameters
 constexpr int kInitialLength = 128;
 constexpr int kLengthMultiple = 4;
+constexpr float kMaxCostGrowth = 1.5f;
+// Grafting stops once the hierarchy could be deeper than the query stack.
+constexpr int kMaxDepth = 128;
 // Fundamental constants
 constexpr int kRoot = 1;
 
@@ -31,10 +42,52 @@ __host__ __device__ int Internal2Node(int internal) { return internal * 2 + 1; }
 __host__ __device__ int Node2Leaf(int node) { return node / 2; }
 __host__ __device__ int Leaf2Node(int leaf) { return leaf * 2; }
 
+// The depth of a radix tree is bounded by the bits of its codes, plus those of
+// the leaf indices that break ties between equal codes.
+template <typename T>
+constexpr int RadixDepth() {
+  return 8 * sizeof(T) + 32;
+}
+
+/**
+ * Walks a hierarchy whose indices are in range from the root, returning the
+ * number of levels below it, or -1 unless every node is reached exactly once,
+ * from the parent it records. The walk gives up below kMaxDepth, as a query's
+ * stack could not hold a deeper tree.
+ */
+int TreeDepth(const VecH<int>& nodeParent,
+              const VecH<thrust::pair<int, int>>& internalChildren) {
+  const int numNodes = nodeParent.size();
+  if (numNodes <= 1) return 0;
+  if (nodeParent[kRoot] != -1) return -1;
+  std::vector<bool> reached(numNodes, false);
+  reached[kRoot] = true;
+  int numReached = 1;
+  int depth = 0;
+  std::vector<thrust::pair<int, int>> stack = {thrust::make_pair(kRoot, 0)};
+  while (!stack.empty()) {
+    const int node = stack.back().first;
+    const int level = stack.back().second + 1;
+    stack.pop_back();
+    if (level > kMaxDepth) return -1;
+    depth = glm::max(depth, level);
+    const thrust::pair<int, int> children =
+        internalChildren[Node2Internal(node)];
+    for (const int child : {children.first, children.second}) {
+      if (reached[child] || nodeParent[child] != node) return -1;
+      reached[child] = true;
+      ++numReached;
+      if (IsInternal(child)) stack.push_back(thrust::make_pair(child, level));
+    }
+  }
+  return numReached == numNodes ? depth : -1;
+}
+
+template <typename T>
 struct CreateRadixTree {
   int* nodeParent_;
   thrust::pair<int, int>* internalChildren_;
-  const VecD<uint32_t> leafMorton_;
+  const VecD<T> leafMorton_;
 
   __host__ __device__ int PrefixLength(uint32_t a, uint32_t b) const {
 // count-leading-zeros is used to find the number of identical highest-order
@@ -46,6 +99,14 @@ struct CreateRadixTree {
 #endif
   }
 
+  __host__ __device__ int PrefixLength(uint64_t a, uint64_t b) const {
+#ifdef __CUDA_ARCH__
+    return __clzll(a ^ b);
+#else
+    return __builtin_clzll(a ^ b);
+#endif
+  }
+
   __host__ __device__ int PrefixLength(int i, int j) const {
     if (j < 0 || j >= leafMorton_.size()) {
       return -1;
@@ -53,7 +114,7 @@ struct CreateRadixTree {
       int out;
       if (leafMorton_[i] == leafMorton_[j])
         // use index to disambiguate
-        out = 32 +
+        out = 8 * sizeof(T) +
               PrefixLength(static_cast<uint32_t>(i), static_cast<uint32_t>(j));
       else
         out = PrefixLength(leafMorton_[i], leafMorton_[j]);
@@ -122,6 +183,7 @@ struct FindCollisions {
   const int maxOverlaps_;
   const Box* nodeBBox_;
   const thrust::pair<int, int>* internalChildren_;
+  const int* leafIndex_;
 
   __host__ __device__ int RecordCollision(int node,
                                           const thrust::tuple<T, int>& query) {
@@ -134,15 +196,17 @@ struct FindCollisions {
       if (pos >= maxOverlaps_)
         return -1;  // Didn't allocate enough memory; bail out
       querryTri_.first[pos] = queryIdx;
-      querryTri_.second[pos] = Node2Leaf(node);
+      const int leaf = Node2Leaf(node);
+      querryTri_.second[pos] =
+          leafIndex_ == nullptr ? leaf : leafIndex_[leaf];
     }
     return overlaps && IsInternal(node);  // Should traverse into node
   }
 
   __host__ __device__ void operator()(thrust::tuple<T, int> query) {
-    // stack cannot overflow because radix tree has max depth 30 (Morton code) +
-    // 32 (index).
-    int stack[64];
+    // stack cannot overflow because the depth of the hierarchy is limited to
+    // kMaxDepth.
+    int stack[kMaxDepth];
     int top = -1;
     // Depth-first search
     int node = kRoot;
@@ -187,12 +251,109 @@ struct BuildInternalBoxes {
   }
 };
 
+struct BoxArea {
+  __host__ __device__ float operator()(const Box& box) {
+    const glm::vec3 size = box.Size();
+    // Nodes whose leaves have all been removed are empty and never visited.
+    if (!(size.x >= 0)) return 0;
+    return 2 * (size.x * size.y + size.y * size.z + size.z * size.x);
+  }
+};
+
 struct TransformBox {
   const glm::mat4x3 transform;
   __host__ __device__ void operator()(Box& box) {
     box = box.Transform(transform);
   }
 };
+
+struct LeafBox {
+  const Box* itemBB;
+  __host__ __device__ Box operator()(int item) { return itemBB[item]; }
+};
+
+struct EmptyBox {
+  __host__ __device__ bool operator()(const Box& box) {
+    return !box.isFinite();
+  }
+};
+
+struct ShiftNodes {
+  const int offset;
+  __host__ __device__ void operator()(int& node) {
+    if (node >= 0) node += offset;
+  }
+  __host__ __device__ void operator()(thrust::pair<int, int>& children) {
+    children.first += offset;
+    children.second += offset;
+  }
+};
+
+struct UnionBoxes : public thrust::binary_function<Box, Box, Box> {
+  __host__ __device__ Box operator()(const Box& a, const Box& b) {
+    return a.Union(b);
+  }
+};
+
+/**
+ * Splices the subtree at subRoot into the hierarchy through the unused
+ * internal node graft. It goes beside the deepest node, down to maxDepth, whose
+ * box already contains newBox, so only the boxes above it grow. The depth of
+ * that node is written to depth.
+ */
+struct GraftSubtree {
+  int* nodeParent_;
+  thrust::pair<int, int>* internalChildren_;
+  int* depth;
+  const Box* nodeBBox_;
+  const Box newBox;
+  const int graft;
+  const int subRoot;
+  const int maxDepth;
+
+  __host__ __device__ void operator()(int) {
+    int node = kRoot;
+    int level = 0;
+    while (IsInternal(node) && level < maxDepth) {
+      const thrust::pair<int, int> children =
+          internalChildren_[Node2Internal(node)];
+      if (nodeBBox_[children.first].Contains(newBox)) {
+        node = children.first;
+      } else if (nodeBBox_[children.second].Contains(newBox)) {
+        node = children.second;
+      } else {
+        break;
+      }
+      ++level;
+    }
+    *depth = level;
+
+    if (IsInternal(node)) {
+      // Move node's children under graft and put graft beside the subtree,
+      // which keeps the root at kRoot.
+      thrust::pair<int, int>& children = internalChildren_[Node2Internal(node)];
+      internalChildren_[Node2Internal(graft)] = children;
+      nodeParent_[children.first] = graft;
+      nodeParent_[children.second] = graft;
+      children = thrust::make_pair(graft, subRoot);
+      nodeParent_[graft] = node;
+      nodeParent_[subRoot] = node;
+    } else {
+      const int parent = nodeParent_[node];
+      thrust::pair<int, int>& children =
+          internalChildren_[Node2Internal(parent)];
+      if (children.first == node)
+        children.first = graft;
+      else
+        children.second = graft;
+      internalChildren_[Node2Internal(graft)] =
+          thrust::make_pair(node, subRoot);
+      nodeParent_[graft] = parent;
+      nodeParent_[node] = graft;
+      nodeParent_[subRoot] = graft;
+    }
+  }
+};
 }  // namespace
 
 namespace manifold {
@@ -202,20 +363,34 @@ namespace manifold {
  * bounding boxes and corresponding Morton codes. It is assumed these vectors
  * are already sorted by increasing Morton code.
  */
-Collider::Collider(const VecDH<Box>& leafBB,
-                   const VecDH<uint32_t>& leafMorton) {
-  ALWAYS_ASSERT(leafBB.size() == leafMorton.size(), userErr,
-                "vectors must be the same length");
-  int num_nodes = 2 * leafBB.size() - 1;
+template <typename T>
+Collider::Collider(const VecDH<Box>& leafBB, const VecDH<T>& leafMorton)
+    : Collider(leafBB, leafMorton, VecDH<int>()) {}
+
+/**
+ * Builds a collider over items that are not themselves in Morton order, such
+ * as the faces of a manifold whose sorting has been deferred, when leafIndex
+ * is not empty. Only the codes are sorted, with leafIndex giving the item of
+ * each leaf, so the items need not be permuted.
+ */
+template <typename T>
+Collider::Collider(const VecDH<Box>& itemBB, const VecDH<T>& leafMorton,
+                   const VecDH<int>& leafIndex)
+    : leafIndex_(leafIndex), maxDepth_(RadixDepth<T>()) {
+  ALWAYS_ASSERT(leafIndex.size() == 0 ? itemBB.size() == leafMorton.size()
+                                      : leafIndex.size() == leafMorton.size(),
+                userErr, "vectors must be the same length");
+  int num_nodes = 2 * leafMorton.size() - 1;
   // assign and allocate members
   nodeBBox_.resize(num_nodes);
   nodeParent_.resize(num_nodes, -1);
-  internalChildren_.resize(leafBB.size() - 1, thrust::make_pair(-1, -1));
+  internalChildren_.resize(leafMorton.size() - 1, thrust::make_pair(-1, -1));
   // organize tree
   thrust::for_each_n(countAt(0), NumInternal(),
-                     CreateRadixTree({nodeParent_.ptrD(),
-                                      internalChildren_.ptrD(), leafMorton}));
-  UpdateBoxes(leafBB);
+                     CreateRadixTree<T>({nodeParent_.ptrD(),
+                                         internalChildren_.ptrD(), leafMorton}));
+  UpdateBoxes(itemBB);
+  buildCost_ = Cost();
 }
 
 /**
@@ -236,12 +411,14 @@ SparseIndices Collider::Collisions(const VecDH<T>& querriesIn) const {
     thrust::for_each_n(
         zip(querriesIn.cbeginD(), countAt(0)), querriesIn.size(),
         FindCollisions<T>({querryTri.ptrDpq(), nOverlapsD.ptrD(), maxOverlaps,
-                           nodeBBox_.ptrD(), internalChildren_.ptrD()}));
+                           nodeBBox_.ptrD(), internalChildren_.ptrD(),
+                           leafIndex_.cptrD()}));
     nOverlaps = nOverlapsD.H()[0];
     if (nOverlaps <= maxOverlaps)
       break;
     else {  // if not enough memory was allocated, guess how much will be needed
-      int lastQuery = querryTri.Get(0).H().back();
+      // A single querry, as for a patch, has a lastQuery of zero.
+      int lastQuery = glm::max(1, querryTri.Get(0).H().back());
       maxOverlaps *= 2 * static_cast<float>(querriesIn.size()) / lastQuery;
       querryTri.Resize(maxOverlaps);
     }
@@ -253,15 +430,24 @@ SparseIndices Collider::Collisions(const VecDH<T>& querriesIn) const {
 
 /**
  * Recalculate the collider's internal bounding boxes without changing the
- * hierarchy.
+ * hierarchy. This is much cheaper than building a new collider, but if the
+ * leaves have moved far enough that siblings are no longer spatially close,
+ * the internal boxes grow and the hierarchy loses its efficiency. In this case
+ * false is returned to indicate that a new collider should be built.
  */
-void Collider::UpdateBoxes(const VecDH<Box>& leafBB) {
-  ALWAYS_ASSERT(leafBB.size() == NumLeaves(), userErr,
+bool Collider::UpdateBoxes(const VecDH<Box>& leafBB) {
+  ALWAYS_ASSERT(leafIndex_.size() != 0 || leafBB.size() == NumLeaves(),
+                userErr,
                 "must have the same number of updated boxes as original");
   // copy in leaf node Boxs
   strided_range<VecDH<Box>::IterD> leaves(nodeBBox_.beginD(), nodeBBox_.endD(),
                                           2);
-  thrust::copy(leafBB.cbeginD(), leafBB.cendD(), leaves.begin());
+  if (leafIndex_.size() == 0) {
+    thrust::copy(leafBB.cbeginD(), leafBB.cendD(), leaves.begin());
+  } else {
+    thrust::transform(leafIndex_.beginD(), leafIndex_.endD(), leaves.begin(),
+                      LeafBox({leafBB.cptrD()}));
+  }
   // create global counters
   VecDH<int> counter_(NumInternal());
   thrust::fill(counter_.beginD(), counter_.endD(), 0);
@@ -270,6 +456,86 @@ void Collider::UpdateBoxes(const VecDH<Box>& leafBB) {
       countAt(0), NumLeaves(),
       BuildInternalBoxes({nodeBBox_.ptrD(), counter_.ptrD(), nodeParent_.ptrD(),
                           internalChildren_.ptrD()}));
+  return buildCost_ == 0 || Cost() <= kMaxCostGrowth * buildCost_;
+}
+
+/**
+ * Updates the hierarchy after a local edit of its items, such as a Boolean
+ * that appends new faces to a manifold and leaves the rest in place, without
+ * rebuilding it. The old items keep their indices, and those that were removed
+ * have empty boxes in itemBB, so their leaves stay in the hierarchy, empty.
+ * Only the new items, listed in newItems in the order of their sorted Morton
+ * codes, are built into a subtree, which is grafted in beside the smallest
+ * node that already encloses it. Every leaf is then refit to itemBB.
+ *
+ * Returns false if the hierarchy has degraded enough that it should be
+ * rebuilt: too deep to graft on to, mostly empty leaves, or too costly.
+ */
+template <typename T>
+bool Collider::Graft(const VecDH<Box>& itemBB, const VecDH<int>& newItems,
+                     const VecDH<T>& newMorton) {
+  ALWAYS_ASSERT(newItems.size() == newMorton.size(), userErr,
+                "vectors must be the same length");
+  if (NumInternal() == 0 || maxDepth_ >= kMaxDepth) return false;
+
+  const int numOld = NumLeaves();
+  if (leafIndex_.size() == 0) {
+    leafIndex_.resize(numOld);
+    thrust::sequence(leafIndex_.beginD(), leafIndex_.endD());
+  }
+
+  const int numNew = newItems.size();
+  if (numNew > 0) {
+    auto newBoxes = perm(itemBB.cbeginD(), newItems.cbeginD());
+    const Box newBox =
+        thrust::reduce(newBoxes, newBoxes + numNew, Box(), UnionBoxes());
+
+    // The subtree's nodes are appended after the old ones, leaving one unused
+    // internal node between them to graft it with.
+    const int offset = Leaf2Node(numOld);
+    VecDH<int> subParent(2 * numNew - 1, -1);
+    VecDH<thrust::pair<int, int>> subChildren(numNew - 1,
+                                              thrust::make_pair(-1, -1));
+    thrust::for_each_n(countAt(0), numNew - 1,
+                       CreateRadixTree<T>({subParent.ptrD(),
+                                           subChildren.ptrD(), newMorton}));
+    thrust::for_each(subParent.beginD(), subParent.endD(),
+                     ShiftNodes({offset}));
+    thrust::for_each(subChildren.beginD(), subChildren.endD(),
+                     ShiftNodes({offset}));
+
+    const int numNode = 2 * (numOld + numNew) - 1;
+    nodeBBox_.resize(numNode);
+    nodeParent_.resize(numNode, -1);
+    thrust::copy(subParent.beginD(), subParent.endD(),
+                 nodeParent_.beginD() + offset);
+    internalChildren_.resize(numOld + numNew - 1, thrust::make_pair(-1, -1));
+    thrust::copy(subChildren.beginD(), subChildren.endD(),
+                 internalChildren_.beginD() + numOld);
+    leafIndex_.resize(numOld + numNew);
+    thrust::copy(newItems.beginD(), newItems.endD(),
+                 leafIndex_.beginD() + numOld);
+
+    VecDH<int> depth(1);
+    const int subRoot = numNew > 1 ? kRoot + offset : offset;
+    thrust::for_each_n(
+        countAt(0), 1,
+        GraftSubtree({nodeParent_.ptrD(), internalChildren_.ptrD(),
+                      depth.ptrD(), nodeBBox_.cptrD(), newBox,
+                      Internal2Node(numOld - 1), subRoot,
+                      kMaxDepth - 1 - RadixDepth<T>()}));
+    // The nodes below the graft are one level deeper, and the subtree is
+    // beneath it.
+    maxDepth_ =
+        glm::max(maxDepth_ + 1, depth.H()[0] + 1 + RadixDepth<T>());
+  }
+
+  const bool refit = UpdateBoxes(itemBB);
+  strided_range<VecDH<Box>::IterD> leaves(nodeBBox_.beginD(), nodeBBox_.endD(),
+                                          2);
+  const int numEmpty =
+      thrust::count_if(leaves.begin(), leaves.end(), EmptyBox());
+  return refit && 2 * numEmpty <= NumLeaves();
 }
 
 /**
@@ -288,10 +554,99 @@ bool Collider::Transform(glm::mat4x3 transform) {
   if (axisAligned) {
     thrust::for_each(nodeBBox_.beginD(), nodeBBox_.endD(),
                      TransformBox({transform}));
+    // Each box maps exactly onto the box of its transformed contents, so the
+    // hierarchy stays valid. A rebuild could order the leaves differently,
+    // e.g. when axes are swapped or with Hilbert codes, but no siblings become
+    // farther apart than the transform itself implies, so the current cost is
+    // taken as the new baseline.
+    buildCost_ = Cost();
   }
   return axisAligned;
 }
 
+/**
+ * Returns the surface area heuristic cost of the hierarchy: the sum of the
+ * surface areas of the internal nodes, relative to the root. This is
+ * proportional to the expected number of nodes visited by a random query.
+ */
+float Collider::Cost() const {
+  if (NumInternal() == 0) return 0;
+  const Box root = *(nodeBBox_.cbeginD() + kRoot);
+  const float rootArea = BoxArea()(root);
+  if (!(rootArea > 0)) return 0;
+  strided_range<VecDH<Box>::IterDc> internal(nodeBBox_.cbeginD() + kRoot,
+                                             nodeBBox_.cendD(), 2);
+  return thrust::transform_reduce(internal.begin(), internal.end(), BoxArea(),
+                                  0.0f, thrust::plus<float>()) /
+         rootArea;
+}
+
+/**
+ * Writes the hierarchy as it stands, so that it can be reloaded by Deserialize
+ * without rebuilding.
+ */
+void Collider::Serialize(std::ostream& stream) const {
+  WriteVec(stream, nodeBBox_);
+  WriteVec(stream, nodeParent_);
+  WriteVec(stream, internalChildren_);
+  WriteVec(stream, leafIndex_);
+  WriteValue(stream, buildCost_);
+}
+
+/**
+ * Reads a hierarchy written by Serialize, which must have numItems leaves.
+ * Every index is checked, and the tree is walked from the root, so that corrupt
+ * data throws here rather than being followed out of bounds, around a cycle or
+ * past the end of the query stack by a later query.
+ */
+void Collider::Deserialize(std::istream& stream, int numItems) {
+  ReadVec(stream, nodeBBox_);
+  ReadVec(stream, nodeParent_);
+  ReadVec(stream, internalChildren_);
+  ReadVec(stream, leafIndex_);
+  ReadValue(stream, buildCost_);
+  const int numNodes = nodeBBox_.size();
+  auto isNode = [numNodes](int node) { return node >= 0 && node < numNodes; };
+  auto isLeaf = [numItems](int leaf) { return leaf >= 0 && leaf < numItems; };
+  ALWAYS_ASSERT(
+      nodeParent_.size() == numNodes &&
+          (numItems == 0 ? numNodes == 0 && NumInternal() == 0
+                         : NumLeaves() == numItems &&
+                               numNodes == NumLeaves() + NumInternal()) &&
+          (leafIndex_.size() == 0 || leafIndex_.size() == numItems) &&
+          std::all_of(nodeParent_.H().begin(), nodeParent_.H().end(),
+                      [&](int node) { return node == -1 || isNode(node); }) &&
+          std::all_of(internalChildren_.H().begin(),
+                      internalChildren_.H().end(),
+                      [&](const thrust::pair<int, int>& children) {
+                        return isNode(children.first) &&
+                               isNode(children.second);
+                      }) &&
+          std::all_of(leafIndex_.H().begin(), leafIndex_.H().end(), isLeaf),
+      userErr, "Serialized collider is inconsistent.");
+  // The width of the codes it was built with is not stored, so the depth is
+  // measured instead.
+  maxDepth_ = TreeDepth(nodeParent_.H(), internalChildren_.H());
+  ALWAYS_ASSERT(maxDepth_ >= 0 && maxDepth_ <= kMaxDepth, userErr,
+                "Serialized collider is inconsistent.");
+}
+
+template Collider::Collider(const VecDH<Box>&, const VecDH<uint32_t>&);
+
+template Collider::Collider(const VecDH<Box>&, const VecDH<uint64_t>&);
+
+template Collider::Collider(const VecDH<Box>&, const VecDH<uint32_t>&,
+                            const VecDH<int>&);
+
+template Collider::Collider(const VecDH<Box>&, const VecDH<uint64_t>&,
+                            const VecDH<int>&);
+
+template bool Collider::Graft(const VecDH<Box>&, const VecDH<int>&,
+                              const VecDH<uint32_t>&);
+
+template bool Collider::Graft(const VecDH<Box>&, const VecDH<int>&,
+                              const VecDH<uint64_t>&);
+
 template SparseIndices Collider::Collisions<Box>(const VecDH<Box>&) const;
 
 template SparseIndices Collider::Collisions<glm::vec3>(
@@ -37,6 +37,16 @@ class Manifold {
       const std::vector<glm::ivec3>& triProperties = std::vector<glm::ivec3>(),
       const std::vector<float>& properties = std::vector<float>(),
       const std::vector<float>& propertyTolerance = std::vector<float>());
+  Manifold(
+      Mesh&&,
+      const std::vector<glm::ivec3>& triProperties = std::vector<glm::ivec3>(),
+      const std::vector<float>& properties = std::vector<float>(),
+      const std::vector<float>& propertyTolerance = std::vector<float>());
+  Manifold(
+      VecView<glm::vec3> vertPos, VecView<glm::ivec3> triVerts,
+      const std::vector<glm::ivec3>& triProperties = std::vector<glm::ivec3>(),
+      const std::vector<float>& properties = std::vector<float>(),
+      const std::vector<float>& propertyTolerance = std::vector<float>());
 
   static Manifold Smooth(const Mesh&,
                          const std::vector<Smoothness>& sharpenedEdges = {});
@@ -76,11 +86,23 @@ class Manifold {
   static int GetCircularSegments(float radius);
   ///@}
 
+  /** @name Memory layout
+   * The verts and faces of each new manifold are sorted along a space-filling
+   * curve for memory locality. Morton (Z-order) is the default, as it is the
+   * cheapest to compute, while Hilbert order has better locality, as
+   * consecutive elements are always spatial neighbors.
+   */
+  ///@{
+  enum class Ordering { MORTON, HILBERT };
+  static void SetOrdering(Ordering);
+  ///@}
+
   /** @name Information
    *  Details of the manifold
    */
   ///@{
   Mesh GetMesh() const;
+  MeshView GetMeshView() const;
   bool IsEmpty() const;
   int NumVert() const;
   int NumEdge() const;
@@ -103,6 +125,15 @@ class Manifold {
   static std::vector<int> MeshID2Original();
   ///@}
 
+  /** @name Serialization
+   *  A binary snapshot of the manifold's internal structures, which loads
+   * without any recomputation.
+   */
+  ///@{
+  void Serialize(std::ostream&) const;
+  static Manifold Deserialize(std::istream&);
+  ///@}
+
   /** @name Modification
    *  Change this manifold in-place.
    */
@@ -113,6 +144,7 @@ class Manifold {
                    float zDegrees = 0.0f);
   Manifold& Transform(const glm::mat4x3&);
   Manifold& Warp(std::function<void(glm::vec3&)>);
+  Manifold& Warp(std::function<void(glm::vec3*, size_t)>);
   Manifold& Refine(int);
   // Manifold RefineToLength(float);
   // Manifold RefineToPrecision(float);
@@ -124,6 +156,9 @@ class Manifold {
   ///@{
   enum class OpType { ADD, SUBTRACT, INTERSECT };
   Manifold Boolean(const Manifold& second, OpType op) const;
+  bool Intersects(const Manifold& second) const;
+  Properties IntersectionProperties(const Manifold& second,
+                                    OpType op = OpType::INTERSECT) const;
   // Boolean operation shorthand
   Manifold operator+(const Manifold&) const;  // ADD (Union)
   Manifold& operator+=(const Manifold&);
@@ -155,10 +190,39 @@ class Manifold {
   struct Impl;
 
  private:
+  friend class EditSession;
   std::unique_ptr<Impl> pImpl_;
   static int circularSegments_;
   static float circularAngle_;
   static float circularEdgeLength_;
+  static Ordering ordering_;
+};
+
+/**
+ * Applies a long series of Booleans to one body, such as many small tool cuts
+ * into a single workpiece, more cheaply than repeated Manifold operators. The
+ * body is edited in place: each operation only rebuilds the faces near the tool
+ * and appends them, its geometry is neither sorted nor compacted, and its
+ * collider has the new faces grafted on rather than being rebuilt, until
+ * Commit is called.
+ */
+class EditSession {
+ public:
+  EditSession(const Manifold& body);
+  ~EditSession();
+
+  void Boolean(const Manifold& tool, Manifold::OpType op);
+  EditSession& operator+=(const Manifold& tool);
+  EditSession& operator-=(const Manifold& tool);
+  EditSession& operator^=(const Manifold& tool);
+  int NumFacesCoded() const;
+  Manifold Commit();
+
+ private:
+  std::unique_ptr<Manifold::Impl> pImpl_;
+  int numFacesCoded_ = 0;
 };
+
+void MergeVerts(Mesh& mesh, float tolerance);
 /** @} */
 }  // namespace manifold
\ No newline at end of file
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thrust/logical.h>
+
 #include "boolean3.cuh"
 
 // TODO: make this runtime configurable for quicker debug
@@ -485,6 +487,63 @@ VecDH<int> Winding03(const Manifold::Impl &inP, SparseIndices &p0q2,
                       thrust::negate<int>());
   return w03;
 };
+
+/**
+ * Patch mode: when inP extends beyond inQ's bounding box, only the patch of
+ * its faces that overlap that box can interact with inQ. Its other verts lie
+ * outside the box, so their winding numbers are zero, and its other edges
+ * cannot reach the box, so they are skipped by the collision queries.
+ */
+struct Patch {
+  bool active;
+  VecDH<int> faces, verts;
+
+  Patch(const Manifold::Impl &inP, const Manifold::Impl &inQ) {
+    const float margin = glm::max(inP.precision_, inQ.precision_);
+    const Box boxQ(inQ.bBox_.min - margin, inQ.bBox_.max + margin);
+    active = !boxQ.Contains(inP.bBox_);
+    if (!active) return;
+    faces = inP.PatchFaces(boxQ);
+    verts = inP.PatchVerts(faces);
+    if (kVerbose)
+      std::cout << "patch: " << faces.size() << " of " << inP.NumTri()
+                << " faces" << std::endl;
+  }
+};
+
+SparseIndices EdgeCollisions(const Manifold::Impl &inQ,
+                             const Manifold::Impl &inP, const Patch &patchP) {
+  return patchP.active ? inQ.EdgeCollisions(inP, patchP.faces)
+                       : inQ.EdgeCollisions(inP);
+}
+
+SparseIndices VertexCollisionsZ(const Manifold::Impl &inQ,
+                                const Manifold::Impl &inP,
+                                const Patch &patchP) {
+  return patchP.active ? inQ.VertexCollisionsZ(inP.vertPos_, patchP.verts)
+                       : inQ.VertexCollisionsZ(inP.vertPos_);
+}
+
+/**
+ * Returns true if any vertex of p0q2 has a non-zero winding number, found by
+ * summing its sorted s02 values. These are copies, so the sort does not affect
+ * the caller's arrays.
+ */
+bool AnyWinding(SparseIndices p0q2, VecDH<int> s02, bool reverse) {
+  const int size = p0q2.size();
+  if (size == 0) return false;
+  if (!thrust::is_sorted(p0q2.beginD(reverse), p0q2.endD(reverse)))
+    thrust::sort_by_key(p0q2.beginD(reverse), p0q2.endD(reverse), s02.beginD());
+  VecDH<int> w03vert(size);
+  VecDH<int> w03val(size);
+  const int numVert =
+      thrust::reduce_by_key(p0q2.beginD(reverse), p0q2.endD(reverse),
+                            s02.beginD(), w03vert.beginD(), w03val.beginD())
+          .second -
+      w03val.beginD();
+  return thrust::any_of(w03val.beginD(), w03val.beginD() + numVert,
+                        thrust::identity<int>());
+}
 }  // namespace
 
 namespace manifold {
@@ -505,24 +564,27 @@ Boolean3::Boolean3(const Manifold::Impl &inP, const Manifold::Impl &inQ,
     return;
   }
 
+  Patch patchP(inP, inQ);
+  const Patch patchQ(inQ, inP);
+
   // Level 3
   // Find edge-triangle overlaps (broad phase)
-  p1q2_ = inQ_.EdgeCollisions(inP_);
+  p1q2_ = EdgeCollisions(inQ_, inP_, patchP);
   p1q2_.Sort();
   if (kVerbose) std::cout << "p1q2 size = " << p1q2_.size() << std::endl;
 
-  p2q1_ = inP_.EdgeCollisions(inQ_);
+  p2q1_ = EdgeCollisions(inP_, inQ_, patchQ);
   p2q1_.SwapPQ();
   p2q1_.Sort();
   if (kVerbose) std::cout << "p2q1 size = " << p2q1_.size() << std::endl;
 
   // Level 2
   // Find vertices that overlap faces in XY-projection
-  SparseIndices p0q2 = inQ.VertexCollisionsZ(inP.vertPos_);
+  SparseIndices p0q2 = VertexCollisionsZ(inQ, inP, patchP);
   p0q2.Sort();
   if (kVerbose) std::cout << "p0q2 size = " << p0q2.size() << std::endl;
 
-  SparseIndices p2q0 = inP.VertexCollisionsZ(inQ.vertPos_);
+  SparseIndices p2q0 = VertexCollisionsZ(inP, inQ, patchQ);
   p2q0.SwapPQ();
   p2q0.Sort();
   if (kVerbose) std::cout << "p2q0 size = " << p2q0.size() << std::endl;
@@ -572,6 +634,11 @@ Boolean3::Boolean3(const Manifold::Impl &inP, const Manifold::Impl &inQ,
 
   w30_ = Winding03(inQ, p2q0, s20, true);
 
+  if (patchP.active) {
+    patchFacesP_ = std::move(patchP.faces);
+    patchVertsP_ = std::move(patchP.verts);
+  }
+
   levels.Stop();
 
   if (kVerbose) {
@@ -580,4 +647,61 @@ Boolean3::Boolean3(const Manifold::Impl &inP, const Manifold::Impl &inQ,
     MemUsage();
   }
 }
-}  // namespace manifold
\ No newline at end of file
+
+/**
+ * Returns true if the interiors of inP and inQ overlap, using the same levels
+ * as the constructor but stopping as soon as the answer is known. First, any
+ * vertex of one inside the other settles it. Otherwise their surfaces can only
+ * overlap where an edge of one crosses a face of the other, which is checked
+ * one direction at a time. As for INTERSECT, P is contracted, so surfaces that
+ * only touch do not count.
+ */
+bool Boolean3::Intersects(const Manifold::Impl &inP,
+                          const Manifold::Impl &inQ) {
+  if (inP.IsEmpty() || inQ.IsEmpty() || !inP.bBox_.DoesOverlap(inQ.bBox_))
+    return false;
+  const float expandP = -1.0f;
+  const Patch patchP(inP, inQ);
+  const Patch patchQ(inQ, inP);
+
+  SparseIndices p0q2 = VertexCollisionsZ(inQ, inP, patchP);
+  p0q2.Sort();
+  VecDH<int> s02;
+  VecDH<float> z02;
+  std::tie(s02, z02) = Shadow02(inP, inQ, p0q2, true, expandP);
+  if (AnyWinding(p0q2, s02, false)) return true;
+
+  SparseIndices p2q0 = VertexCollisionsZ(inP, inQ, patchQ);
+  p2q0.SwapPQ();
+  p2q0.Sort();
+  VecDH<int> s20;
+  VecDH<float> z20;
+  std::tie(s20, z20) = Shadow02(inQ, inP, p2q0, false, expandP);
+  if (AnyWinding(p2q0, s20, true)) return true;
+
+  SparseIndices p1q2 = EdgeCollisions(inQ, inP, patchP);
+  p1q2.Sort();
+  SparseIndices p2q1 = EdgeCollisions(inP, inQ, patchQ);
+  p2q1.SwapPQ();
+  p2q1.Sort();
+  if (p1q2.size() == 0 && p2q1.size() == 0) return false;
+
+  SparseIndices p1q1 = Filter11(inP, inQ, p1q2, p2q1);
+  VecDH<int> s11;
+  VecDH<glm::vec4> xyzz11;
+  std::tie(s11, xyzz11) = Shadow11(p1q1, inP, inQ, expandP);
+
+  VecDH<int> x12;
+  VecDH<glm::vec3> v12;
+  std::tie(x12, v12) = Intersect12(inP, inQ, s02, p0q2, s11, p1q1, z02, xyzz11,
+                                   p1q2, true);
+  if (thrust::any_of(x12.beginD(), x12.endD(), thrust::identity<int>()))
+    return true;
+
+  VecDH<int> x21;
+  VecDH<glm::vec3> v21;
+  std::tie(x21, v21) = Intersect12(inQ, inP, s20, p2q0, s11, p1q1, z20, xyzz11,
+                                   p2q1, false);
+  return thrust::any_of(x21.beginD(), x21.endD(), thrust::identity<int>());
+}
+}  // namespace manifold
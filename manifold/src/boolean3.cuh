@@ -43,6 +43,10 @@ class Boolean3 {
   Boolean3(const Manifold::Impl& inP, const Manifold::Impl& inQ,
            Manifold::OpType op);
   Manifold::Impl Result(Manifold::OpType op) const;
+  int StitchPatch(Manifold::OpType op, Manifold::Impl& outP) const;
+  Properties ResultProperties(Manifold::OpType op) const;
+  static bool Intersects(const Manifold::Impl& inP,
+                         const Manifold::Impl& inQ);
 
  private:
   const Manifold::Impl &inP_, &inQ_;
@@ -50,5 +54,13 @@ class Boolean3 {
   SparseIndices p1q2_, p2q1_;
   VecDH<int> x12_, x21_, w03_, w30_;
   VecDH<glm::vec3> v12_, v21_;
+  // The sorted faces and verts of P that overlap Q's bounding box, when P
+  // extends beyond it, and otherwise empty.
+  VecDH<int> patchFacesP_, patchVertsP_;
+
+  Boolean3(const Boolean3& boolean, const Manifold::Impl& patchP);
+  Manifold::Impl Assemble(Manifold::OpType op, VecDH<int>& faceEdge,
+                          VecDH<BaryRef>& faceRef, VecDH<int>& halfedgeBary,
+                          bool meshRelation, VecDH<int>* i03P = nullptr) const;
 };
 }  // namespace manifold
\ No newline at end of file
@@ -49,6 +49,7 @@ struct CountVerts {
   const int *inclusion;
 
   __host__ __device__ void operator()(const Halfedge &edge) {
+    if (edge.startVert < 0) return;
     AtomicAdd(count[edge.face], glm::abs(inclusion[edge.startVert]));
   }
 };
@@ -74,6 +75,12 @@ struct NotZero : public thrust::unary_function<int, int> {
   __host__ __device__ int operator()(int x) const { return x > 0 ? 1 : 0; }
 };
 
+struct DropRemovedVert {
+  __host__ __device__ void operator()(thrust::tuple<int &, glm::vec3> inOut) {
+    if (isnan(thrust::get<1>(inOut).x)) thrust::get<0>(inOut) = 0;
+  }
+};
+
 std::tuple<VecDH<int>, VecDH<int>> SizeOutput(
     Manifold::Impl &outR, const Manifold::Impl &inP, const Manifold::Impl &inQ,
     const VecDH<int> &i03, const VecDH<int> &i30, const VecDH<int> &i12,
@@ -358,7 +365,10 @@ struct DuplicateHalfedges {
   __host__ __device__ void operator()(thrust::tuple<bool, Halfedge, int> in) {
     if (!thrust::get<0>(in)) return;
     Halfedge halfedge = thrust::get<1>(in);
-    if (!halfedge.IsForward()) return;
+    if (halfedge.startVert < 0) return;
+    // A halfedge on the boundary of a patch has no pair, so it is copied alone.
+    const bool boundary = halfedge.pairedHalfedge < 0;
+    if (!boundary && !halfedge.IsForward()) return;
     const int edgeP = thrust::get<2>(in);
 
     const int inclusion = i03[halfedge.startVert];
@@ -372,13 +382,25 @@ struct DuplicateHalfedges {
     halfedge.endVert = vP2R[halfedge.endVert];
     const int faceLeftP = halfedge.face;
     halfedge.face = faceP2R[faceLeftP];
-    const int faceRightP = halfedgesP[halfedge.pairedHalfedge].face;
-    const int faceRight = faceP2R[faceRightP];
     // Negative inclusion means the halfedges are reversed, which means our
     // reference is now to the endVert instead of the startVert, which is one
     // position advanced CCW.
     const Ref forwardRef = {forward ? 0 : 1, faceLeftP,
                             (edgeP + (inclusion < 0 ? 1 : 0)) % 3};
+
+    if (boundary) {
+      for (int i = 0; i < glm::abs(inclusion); ++i) {
+        const int forwardEdge = AtomicAdd(facePtr[halfedge.face], 1);
+        halfedgesR[forwardEdge] = halfedge;
+        halfedgeRef[forwardEdge] = forwardRef;
+        ++halfedge.startVert;
+        ++halfedge.endVert;
+      }
+      return;
+    }
+
+    const int faceRightP = halfedgesP[halfedge.pairedHalfedge].face;
+    const int faceRight = faceP2R[faceRightP];
     const Ref backwardRef = {
         forward ? 0 : 1, faceRightP,
         (halfedge.pairedHalfedge + (inclusion < 0 ? 1 : 0)) % 3};
@@ -495,14 +517,240 @@ std::pair<VecDH<BaryRef>, VecDH<int>> CalculateMeshRelation(
   outR.meshRelation_.barycentric.resize(idx.H()[0]);
   return std::make_pair(faceRef, halfedgeBary);
 }
+
+/**
+ * Returns the index of key in the sorted array, or -1 if it is not there.
+ */
+__host__ __device__ int IndexOf(const int *sorted, int size, int key) {
+  int begin = 0;
+  int end = size;
+  while (begin < end) {
+    const int mid = (begin + end) / 2;
+    if (sorted[mid] < key)
+      begin = mid + 1;
+    else
+      end = mid;
+  }
+  return begin < size && sorted[begin] == key ? begin : -1;
+}
+
+struct PatchFace {
+  const int *faces;
+  const int numFace;
+
+  __host__ __device__ void operator()(int &face) {
+    face = IndexOf(faces, numFace, face);
+  }
+};
+
+struct PatchHalfedge {
+  const int *faces;
+  const int numFace;
+
+  __host__ __device__ void operator()(int &halfedge) {
+    halfedge = 3 * IndexOf(faces, numFace, halfedge / 3) + halfedge % 3;
+  }
+};
+
+struct CopyPatchFace {
+  Halfedge *halfedgePatch;
+  BaryRef *triBaryPatch;
+  int *baryPatch;
+  const Halfedge *halfedgeP;
+  const BaryRef *triBaryP;
+  const int *faces;
+  const int numFace;
+  const int *verts;
+  const int numVert;
+
+  __host__ __device__ void operator()(int face) {
+    const int faceP = faces[face];
+    for (const int i : {0, 1, 2}) {
+      const Halfedge edge = halfedgeP[3 * faceP + i];
+      const int pairedFace = IndexOf(faces, numFace, edge.pairedHalfedge / 3);
+      halfedgePatch[3 * face + i] = {
+          IndexOf(verts, numVert, edge.startVert),
+          IndexOf(verts, numVert, edge.endVert),
+          pairedFace < 0 ? -1 : 3 * pairedFace + edge.pairedHalfedge % 3, face};
+    }
+    const BaryRef ref = triBaryP[faceP];
+    triBaryPatch[face] = ref;
+    for (const int i : {0, 1, 2}) baryPatch[3 * face + i] = ref.vertBary[i];
+  }
+};
+
+struct IsNegative {
+  __host__ __device__ bool operator()(int x) { return x < 0; }
+};
+
+struct RemapBary {
+  const int *bary;
+  const int numBary;
+  const int offset;
+
+  __host__ __device__ void operator()(BaryRef &ref) {
+    for (const int i : {0, 1, 2}) {
+      int &vertBary = ref.vertBary[i];
+      if (vertBary < 0) continue;
+      if (bary != nullptr) vertBary = IndexOf(bary, numBary, vertBary);
+      vertBary += offset;
+    }
+  }
+};
+
+/**
+ * Copies the given faces and verts of inP, both sorted, into a mesh of their
+ * own, with only the barycentric coordinates they refer to. Halfedges paired
+ * outside of the patch are left unpaired, which marks its boundary.
+ */
+Manifold::Impl ExtractPatch(const Manifold::Impl &inP, const VecDH<int> &faces,
+                            const VecDH<int> &verts) {
+  const int numFace = faces.size();
+  const int numVert = verts.size();
+  Manifold::Impl patch;
+  patch.precision_ = inP.precision_;
+  patch.vertPos_.resize(numVert);
+  thrust::gather(verts.beginD(), verts.endD(), inP.vertPos_.beginD(),
+                 patch.vertPos_.beginD());
+  patch.faceNormal_.resize(numFace);
+  thrust::gather(faces.beginD(), faces.endD(), inP.faceNormal_.beginD(),
+                 patch.faceNormal_.beginD());
+
+  patch.halfedge_.resize(3 * numFace);
+  patch.meshRelation_.triBary.resize(numFace);
+  VecDH<int> bary(3 * numFace);
+  thrust::for_each_n(
+      countAt(0), numFace,
+      CopyPatchFace({patch.halfedge_.ptrD(), patch.meshRelation_.triBary.ptrD(),
+                     bary.ptrD(), inP.halfedge_.cptrD(),
+                     inP.meshRelation_.triBary.cptrD(), faces.cptrD(), numFace,
+                     verts.cptrD(), numVert}));
+
+  int numBary =
+      thrust::remove_if(bary.beginD(), bary.endD(), IsNegative()) -
+      bary.beginD();
+  thrust::sort(bary.beginD(), bary.beginD() + numBary);
+  numBary = thrust::unique(bary.beginD(), bary.beginD() + numBary) -
+            bary.beginD();
+  bary.resize(numBary);
+  patch.meshRelation_.barycentric.resize(numBary);
+  thrust::gather(bary.beginD(), bary.endD(),
+                 inP.meshRelation_.barycentric.beginD(),
+                 patch.meshRelation_.barycentric.beginD());
+  thrust::for_each(patch.meshRelation_.triBary.beginD(),
+                   patch.meshRelation_.triBary.endD(),
+                   RemapBary({bary.cptrD(), numBary, 0}));
+  return patch;
+}
+
+struct BoundaryEdge {
+  TmpEdge *edges;
+  const Halfedge *halfedgeP;
+  const Halfedge *halfedgePatch;
+  const int *faces;
+
+  __host__ __device__ void operator()(int edge) {
+    if (halfedgePatch[edge].pairedHalfedge >= 0) {
+      edges[edge] = TmpEdge(0, 0, -1);
+      return;
+    }
+    const int outside =
+        halfedgeP[3 * faces[edge / 3] + edge % 3].pairedHalfedge;
+    edges[edge] = TmpEdge(halfedgeP[outside].startVert,
+                          halfedgeP[outside].endVert, outside);
+  }
+};
+
+struct KeepPatchVert {
+  int *vertR2P;
+  glm::vec3 *vertPosP;
+
+  __host__ __device__ void operator()(thrust::tuple<int, int, int> in) {
+    const int inclusion = thrust::get<0>(in);
+    const int vertR = thrust::get<1>(in);
+    const int vertP = thrust::get<2>(in);
+    if (inclusion == 0)
+      vertPosP[vertP] = glm::vec3(0.0f / 0.0f);
+    else
+      vertR2P[vertR] = vertP;
+  }
+};
+
+struct RemoveFace {
+  Halfedge *halfedge;
+
+  __host__ __device__ void operator()(int face) {
+    for (const int i : {0, 1, 2}) halfedge[3 * face + i] = {-1, -1, -1, -1};
+  }
+};
+
+struct AppendTri {
+  Halfedge *halfedges;
+  TmpEdge *edges;
+  const int *vertR2P;
+  const int firstFace;
+
+  __host__ __device__ void operator()(thrust::tuple<int, glm::ivec3> in) {
+    const int tri = thrust::get<0>(in);
+    const glm::ivec3 triVerts = thrust::get<1>(in);
+    const int face = firstFace + tri;
+    for (const int i : {0, 1, 2}) {
+      const int start = vertR2P[triVerts[i]];
+      const int end = vertR2P[triVerts[(i + 1) % 3]];
+      halfedges[3 * face + i] = {start, end, -1, face};
+      edges[3 * tri + i] = TmpEdge(start, end, 3 * face + i);
+    }
+  }
+};
+
+template <typename T>
+void Append(VecDH<T> &vec, const VecDH<T> &more) {
+  const int size = vec.size();
+  vec.resize(size + more.size());
+  thrust::copy(more.beginD(), more.endD(), vec.beginD() + size);
+}
 }  // namespace
 
 namespace manifold {
 
-Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
-  Timer assemble;
-  assemble.Start();
+/**
+ * Restricts the intersections found by boolean to its patch of P, which has
+ * been copied into patchP by ExtractPatch. The patch faces and verts are
+ * sorted, so the renumbered intersections stay sorted too.
+ */
+Boolean3::Boolean3(const Boolean3 &boolean, const Manifold::Impl &patchP)
+    : inP_(patchP),
+      inQ_(boolean.inQ_),
+      expandP_(boolean.expandP_),
+      p1q2_(boolean.p1q2_),
+      p2q1_(boolean.p2q1_),
+      x12_(boolean.x12_),
+      x21_(boolean.x21_),
+      w03_(boolean.patchVertsP_.size()),
+      w30_(boolean.w30_),
+      v12_(boolean.v12_),
+      v21_(boolean.v21_) {
+  const VecDH<int> &faces = boolean.patchFacesP_;
+  thrust::for_each(p1q2_.beginD(false), p1q2_.endD(false),
+                   PatchHalfedge({faces.cptrD(), faces.size()}));
+  thrust::for_each(p2q1_.beginD(false), p2q1_.endD(false),
+                   PatchFace({faces.cptrD(), faces.size()}));
+  thrust::gather(boolean.patchVertsP_.beginD(), boolean.patchVertsP_.endD(),
+                 boolean.w03_.beginD(), w03_.beginD());
+}
 
+/**
+ * Builds the verts and polygonal faces of the result, where the halfedges of
+ * each face start at faceEdge and are not yet in order. The mesh relation is
+ * only calculated when requested, as it is needed for triangulation but not
+ * for properties. If i03P is given, it is filled with the inclusion of each
+ * vert of P, which is how many copies of it begin the result's verts. Assumes
+ * the cases of an empty input have been handled.
+ */
+Manifold::Impl Boolean3::Assemble(Manifold::OpType op, VecDH<int> &faceEdge,
+                                  VecDH<BaryRef> &faceRef,
+                                  VecDH<int> &halfedgeBary, bool meshRelation,
+                                  VecDH<int> *i03P) const {
   if ((expandP_ > 0) != (op == Manifold::OpType::ADD))
     std::cout << "Warning! Result op type not compatible with constructor op "
                  "type: coplanar faces may have incorrect results."
@@ -531,18 +779,6 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
       throw std::invalid_argument("invalid enum: OpType.");
   }
 
-  if (w03_.size() == 0) {
-    if (w30_.size() != 0 && op == Manifold::OpType::ADD) {
-      return inQ_;
-    }
-    return Manifold::Impl();
-  } else if (w30_.size() == 0) {
-    if (op == Manifold::OpType::INTERSECT) {
-      return Manifold::Impl();
-    }
-    return inP_;
-  }
-
   const bool invertQ = op == Manifold::OpType::SUBTRACT;
 
   // Convert winding numbers to inclusion values based on operation type.
@@ -554,6 +790,11 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
   thrust::transform(x21_.beginD(), x21_.endD(), i21.beginD(), c3 * _1);
   thrust::transform(w03_.beginD(), w03_.endD(), i03.beginD(), c1 + c3 * _1);
   thrust::transform(w30_.beginD(), w30_.endD(), i30.beginD(), c2 + c3 * _1);
+  // P may be the body of an EditSession, which still holds the verts and
+  // faces flagged for removal by its last Boolean; they are dropped here.
+  thrust::for_each_n(zip(i03.beginD(), inP_.vertPos_.cbeginD()),
+                     inP_.NumVert(), DropRemovedVert());
+  if (i03P != nullptr) *i03P = i03;
 
   VecDH<int> vP2R(inP_.NumVert());
   thrust::exclusive_scan(i03.beginD(), i03.endD(), vP2R.beginD(), 0, AbsSum());
@@ -626,7 +867,6 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
                   inQ_.halfedge_.H(), false);
 
   // Level 4
-  VecDH<int> faceEdge;
   VecDH<int> facePQ2R;
   std::tie(faceEdge, facePQ2R) =
       SizeOutput(outR, inP_, inQ_, i03, i30, i12, i21, p1q2_, p2q1_, invertQ);
@@ -640,7 +880,7 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
   VecDH<bool> wholeHalfedgeQ(inQ_.halfedge_.size(), true);
   // The halfedgeRef contains the data that will become triBary once the faces
   // are triangulated.
-  VecDH<Ref> halfedgeRef(2 * outR.NumEdge());
+  VecDH<Ref> halfedgeRef(outR.halfedge_.size());
 
   AppendPartialEdges(outR, wholeHalfedgeP.H(), facePtrR.H(), edgesP,
                      halfedgeRef.H(), inP_, i03.H(), vP2R.H(), facePQ2R.begin(),
@@ -657,10 +897,48 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
   AppendWholeEdges(outR, facePtrR, halfedgeRef, inQ_, wholeHalfedgeQ, i30, vQ2R,
                    facePQ2R.cptrD() + inP_.NumTri(), false);
 
+  if (meshRelation)
+    std::tie(faceRef, halfedgeBary) = CalculateMeshRelation(
+        outR, halfedgeRef, inP_, inQ_, nPv + nQv, numFaceR, invertQ);
+
+  return outR;
+}
+
+/**
+ * Builds the result of the Boolean. When P extends beyond Q, an ADD or
+ * SUBTRACT only changes P's patch, so its result is stitched into a copy of P
+ * instead of being assembled from all of P's faces.
+ */
+Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
+  if (w03_.size() == 0) {
+    if (w30_.size() != 0 && op == Manifold::OpType::ADD) {
+      return inQ_;
+    }
+    return Manifold::Impl();
+  } else if (w30_.size() == 0) {
+    if (op == Manifold::OpType::INTERSECT) {
+      return Manifold::Impl();
+    }
+    return inP_;
+  }
+
+  if (patchFacesP_.size() > 0 && op != Manifold::OpType::INTERSECT) {
+    Manifold::Impl outR = inP_;
+    outR.DuplicateMeshIDs();
+    StitchPatch(op, outR);
+    outR.Finish();
+    return outR;
+  }
+
+  Timer assemble;
+  assemble.Start();
+
+  VecDH<int> faceEdge;
   VecDH<BaryRef> faceRef;
   VecDH<int> halfedgeBary;
-  std::tie(faceRef, halfedgeBary) = CalculateMeshRelation(
-      outR, halfedgeRef, inP_, inQ_, nPv + nQv, numFaceR, invertQ);
+  Manifold::Impl outR =
+      Assemble(op, faceEdge, faceRef, halfedgeBary, true);
+  if (outR.IsEmpty()) return outR;
 
   assemble.Stop();
   Timer triangulate;
@@ -697,4 +975,116 @@ Manifold::Impl Boolean3::Result(Manifold::OpType op) const {
   return outR;
 }
 
-}  // namespace manifold
\ No newline at end of file
+/**
+ * Applies the result of an ADD or SUBTRACT to outP, which is P or a copy of it,
+ * by replacing only P's patch. The patch is assembled and triangulated on its
+ * own, then its faces are flagged for removal and the new triangles are
+ * appended and paired with the untouched remainder along the patch boundary,
+ * where the verts are all kept, as they lie outside of Q. Nothing is sorted or
+ * compacted. Returns the first new face, or -1 if P has no patch or op is
+ * INTERSECT, which keeps none of the remainder; outP is then left as it was.
+ */
+int Boolean3::StitchPatch(Manifold::OpType op, Manifold::Impl &outP) const {
+  if (patchFacesP_.size() == 0 || op == Manifold::OpType::INTERSECT) return -1;
+
+  // Everything is read from P before outP, which may be P, is written.
+  const int numFace = patchFacesP_.size();
+  const Manifold::Impl patchP =
+      ExtractPatch(inP_, patchFacesP_, patchVertsP_);
+  VecDH<TmpEdge> edge(3 * numFace);
+  thrust::for_each_n(
+      countAt(0), 3 * numFace,
+      BoundaryEdge({edge.ptrD(), inP_.halfedge_.cptrD(),
+                    patchP.halfedge_.cptrD(), patchFacesP_.cptrD()}));
+  const int numBoundary =
+      thrust::remove_if(edge.beginD(), edge.endD(), TmpInvalid()) -
+      edge.beginD();
+
+  const Boolean3 patch(*this, patchP);
+  VecDH<int> faceEdge;
+  VecDH<BaryRef> faceRef;
+  VecDH<int> halfedgeBary;
+  VecDH<int> i03;
+  Manifold::Impl patchR =
+      patch.Assemble(op, faceEdge, faceRef, halfedgeBary, true, &i03);
+  VecDH<glm::ivec3> triVerts;
+  if (!patchR.IsEmpty()) {
+    triVerts = patchR.TriangulateFaces(faceEdge, faceRef, halfedgeBary);
+    patchR.DuplicateMeshIDs();
+  }
+
+  // The verts of the patch stay in place, unless they were removed, and the
+  // rest of the result's verts are appended.
+  const int numVertR = patchR.NumVert();
+  VecDH<int> vP2R(i03.size());
+  thrust::exclusive_scan(i03.beginD(), i03.endD(), vP2R.beginD(), 0, AbsSum());
+  VecDH<int> vertR2P(numVertR, -1);
+  thrust::for_each_n(
+      zip(i03.beginD(), vP2R.beginD(), patchVertsP_.beginD()), i03.size(),
+      KeepPatchVert({vertR2P.ptrD(), outP.vertPos_.ptrD()}));
+  VecDH<int> newVertR(numVertR);
+  const int numNewVert =
+      thrust::copy_if(countAt(0), countAt(numVertR), vertR2P.beginD(),
+                      newVertR.beginD(), IsNegative()) -
+      newVertR.beginD();
+  newVertR.resize(numNewVert);
+  const int firstNewVert = outP.NumVert();
+  thrust::scatter(countAt(firstNewVert), countAt(firstNewVert + numNewVert),
+                  newVertR.beginD(), vertR2P.beginD());
+  outP.vertPos_.resize(firstNewVert + numNewVert);
+  thrust::gather(newVertR.beginD(), newVertR.endD(), patchR.vertPos_.beginD(),
+                 outP.vertPos_.beginD() + firstNewVert);
+
+  thrust::for_each(patchFacesP_.beginD(), patchFacesP_.endD(),
+                   RemoveFace({outP.halfedge_.ptrD()}));
+  const int firstNewFace = outP.NumTri();
+  const int numNewFace = triVerts.size();
+  outP.halfedge_.resize(3 * (firstNewFace + numNewFace));
+  edge.resize(numBoundary + 3 * numNewFace);
+  thrust::for_each_n(
+      zip(countAt(0), triVerts.beginD()), numNewFace,
+      AppendTri({outP.halfedge_.ptrD(), edge.ptrD() + numBoundary,
+                 vertR2P.cptrD(), firstNewFace}));
+  outP.PairHalfedges(edge);
+
+  thrust::for_each(patchR.meshRelation_.triBary.beginD(),
+                   patchR.meshRelation_.triBary.endD(),
+                   RemapBary({nullptr, 0,
+                              static_cast<int>(
+                                  outP.meshRelation_.barycentric.size())}));
+  Append(outP.meshRelation_.barycentric, patchR.meshRelation_.barycentric);
+  Append(outP.meshRelation_.triBary, patchR.meshRelation_.triBary);
+  Append(outP.faceNormal_, patchR.faceNormal_);
+  outP.halfedgeTangent_.resize(0);
+  outP.precision_ = glm::max(outP.precision_, inQ_.precision_);
+
+  outP.CollapseDegenerates(3 * firstNewFace);
+  return firstNewFace;
+}
+
+/**
+ * Returns the surface area and volume of Result(op) without building it. The
+ * polygonal faces from Assemble are summed directly, which skips the
+ * triangulation, collapse and finishing steps.
+ */
+Properties Boolean3::ResultProperties(Manifold::OpType op) const {
+  if (w03_.size() == 0) {
+    if (w30_.size() != 0 && op == Manifold::OpType::ADD) {
+      return inQ_.GetProperties();
+    }
+    return {0, 0};
+  } else if (w30_.size() == 0) {
+    if (op == Manifold::OpType::INTERSECT) {
+      return {0, 0};
+    }
+    return inP_.GetProperties();
+  }
+
+  VecDH<int> faceEdge;
+  VecDH<BaryRef> faceRef;
+  VecDH<int> halfedgeBary;
+  const Manifold::Impl outR =
+      Assemble(op, faceEdge, faceRef, halfedgeBary, false);
+  return outR.GetPolygonProperties(faceEdge);
+}
+}  // namespace manifold
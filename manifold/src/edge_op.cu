@@ -111,12 +111,15 @@ namespace manifold {
  *
  * Rather than actually removing the edges, this step merely marks them for
  * removal, by setting vertPos to NaN and halfedge to {-1, -1, -1, -1}.
+ *
+ * Only the halfedges from firstEdge on are checked, so that the faces a Boolean
+ * appended to an otherwise unchanged mesh can be cleaned up on their own.
  */
-void Manifold::Impl::CollapseDegenerates() {
+void Manifold::Impl::CollapseDegenerates(int firstEdge) {
   VecDH<int> flaggedEdges(halfedge_.size());
   int numFlagged =
       thrust::copy_if(
-          countAt(0), countAt(halfedge_.size()), flaggedEdges.beginD(),
+          countAt(firstEdge), countAt(halfedge_.size()), flaggedEdges.beginD(),
           ShortEdge({halfedge_.cptrD(), vertPos_.cptrD(), precision_})) -
       flaggedEdges.beginD();
   flaggedEdges.resize(numFlagged);
@@ -126,7 +129,7 @@ void Manifold::Impl::CollapseDegenerates() {
   flaggedEdges.resize(halfedge_.size());
   numFlagged =
       thrust::copy_if(
-          countAt(0), countAt(halfedge_.size()), flaggedEdges.beginD(),
+          countAt(firstEdge), countAt(halfedge_.size()), flaggedEdges.beginD(),
           FlagEdge({halfedge_.cptrD(), meshRelation_.triBary.cptrD()})) -
       flaggedEdges.beginD();
   flaggedEdges.resize(numFlagged);
@@ -135,7 +138,8 @@ void Manifold::Impl::CollapseDegenerates() {
 
   flaggedEdges.resize(halfedge_.size());
   numFlagged = thrust::copy_if(
-                   countAt(0), countAt(halfedge_.size()), flaggedEdges.beginD(),
+                   countAt(firstEdge), countAt(halfedge_.size()),
+                   flaggedEdges.beginD(),
                    SwappableEdge({halfedge_.cptrD(), vertPos_.cptrD(),
                                   faceNormal_.cptrD(), precision_})) -
                flaggedEdges.beginD();
@@ -32,6 +32,17 @@ namespace manifold {
 void Manifold::Impl::Face2Tri(const VecDH<int>& faceEdge,
                               const VecDH<BaryRef>& faceRef,
                               const VecDH<int>& halfedgeBary) {
+  CreateAndFixHalfedges(TriangulateFaces(faceEdge, faceRef, halfedgeBary));
+}
+
+/**
+ * The first half of Face2Tri: returns the triangles of the faces and replaces
+ * faceNormal_ and the triBary with theirs, but leaves halfedge_ alone. This
+ * allows the triangles to be added to another mesh instead.
+ */
+VecDH<glm::ivec3> Manifold::Impl::TriangulateFaces(
+    const VecDH<int>& faceEdge, const VecDH<BaryRef>& faceRef,
+    const VecDH<int>& halfedgeBary) {
   VecDH<glm::ivec3> triVertsOut;
   VecDH<glm::vec3> triNormalOut;
 
@@ -43,16 +54,32 @@ void Manifold::Impl::Face2Tri(const VecDH<int>& faceEdge,
   const VecH<glm::vec3>& faceNormal = faceNormal_.H();
   meshRelation_.triBary.resize(0);
 
+  // Assigns the barycentric references of the face to its triangles, which
+  // start at startTri.
+  auto addTriBary = [&](int face, int startTri) {
+    std::map<int, int> vertBary;
+    for (int j = faceEdgeH[face]; j < faceEdgeH[face + 1]; ++j)
+      vertBary[halfedge[j].startVert] = halfedgeBary.H()[j];
+
+    for (int tri = startTri; tri < triVerts.size(); ++tri) {
+      meshRelation_.triBary.H().push_back(faceRef.H()[face]);
+      for (int k : {0, 1, 2}) {
+        meshRelation_.triBary.H().back().vertBary[k] =
+            vertBary[triVerts[tri][k]];
+      }
+    }
+  };
+
+  // Faces of more than four edges are gathered to be triangulated together.
+  std::vector<int> generalFaces;
+  std::vector<Polygons> generalPolys;
+
   for (int face = 0; face < faceEdgeH.size() - 1; ++face) {
     const int firstEdge = faceEdgeH[face];
     const int lastEdge = faceEdgeH[face + 1];
     const int numEdge = lastEdge - firstEdge;
     ALWAYS_ASSERT(numEdge >= 3, topologyErr, "face has less than three edges.");
     const glm::vec3 normal = faceNormal[face];
-
-    std::map<int, int> vertBary;
-    for (int j = firstEdge; j < lastEdge; ++j)
-      vertBary[halfedge[j].startVert] = halfedgeBary.H()[j];
     const int startTri = triVerts.size();
 
     if (numEdge == 3) {  // Single triangle
@@ -118,9 +145,8 @@ void Manifold::Impl::Face2Tri(const VecDH<int>& faceEdge,
     } else {  // General triangulation
       const glm::mat3x2 projection = GetAxisAlignedProjection(normal);
 
-      Polygons polys;
       try {
-        polys = Face2Polygons(face, projection, faceEdgeH);
+        generalPolys.push_back(Face2Polygons(face, projection, faceEdgeH));
       } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         for (int edge = faceEdgeH[face]; edge < faceEdgeH[face + 1]; ++edge)
@@ -128,25 +154,31 @@ void Manifold::Impl::Face2Tri(const VecDH<int>& faceEdge,
                     << std::endl;
         throw;
       }
+      generalFaces.push_back(face);
+      continue;
+    }
 
-      std::vector<glm::ivec3> newTris = Triangulate(polys, precision_);
+    addTriBary(face, startTri);
+  }
 
-      for (auto tri : newTris) {
-        triVerts.push_back(tri);
-        triNormal.push_back(normal);
-      }
-    }
+  std::vector<int> triOffset;
+  const std::vector<glm::ivec3> newTris = TriangulateBatch(
+      generalPolys, std::vector<float>(generalPolys.size(), precision_),
+      triOffset);
+  triVerts.reserve(triVerts.size() + newTris.size());
+  triNormal.reserve(triNormal.size() + newTris.size());
 
-    for (int tri = startTri; tri < triVerts.size(); ++tri) {
-      meshRelation_.triBary.H().push_back(faceRef.H()[face]);
-      for (int k : {0, 1, 2}) {
-        meshRelation_.triBary.H().back().vertBary[k] =
-            vertBary[triVerts[tri][k]];
-      }
-    }
+  for (int i = 0; i < generalFaces.size(); ++i) {
+    const int face = generalFaces[i];
+    const int startTri = triVerts.size();
+    triVerts.insert(triVerts.end(), newTris.begin() + triOffset[i],
+                    newTris.begin() + triOffset[i + 1]);
+    triNormal.insert(triNormal.end(), triOffset[i + 1] - triOffset[i],
+                     faceNormal[face]);
+    addTriBary(face, startTri);
   }
   faceNormal_ = triNormalOut;
-  CreateAndFixHalfedges(triVertsOut);
+  return triVertsOut;
 }
 
 /**
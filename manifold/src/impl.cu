@@ -12,14 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
+#include <thrust/gather.h>
 #include <thrust/logical.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/unique.h>
 
 #include <algorithm>
-#include <boost/config.hpp>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/connected_components.hpp>
-#include <map>
 
 #include "impl.cuh"
 
@@ -70,6 +72,8 @@ struct AssignNormals {
     glm::vec3& triNormal = thrust::get<0>(in);
     const int face = thrust::get<1>(in);
 
+    if (halfedges[3 * face].pairedHalfedge < 0) return;
+
     glm::ivec3 triVerts;
     for (int i : {0, 1, 2}) triVerts[i] = halfedges[3 * face + i].startVert;
 
@@ -99,6 +103,37 @@ struct AssignNormals {
   }
 };
 
+struct FanNormal {
+  glm::vec3* vertNormal;
+  const glm::vec3* vertPos;
+  const Halfedge* halfedges;
+  const glm::vec3* faceNormal;
+
+  __host__ __device__ void operator()(int edge) {
+    if (halfedges[edge].pairedHalfedge < 0) return;
+    const int vert = halfedges[edge].startVert;
+    const glm::vec3 pos = vertPos[vert];
+
+    // Walk the faces around vert, summing their corner-angle-weighted normals
+    // as AssignNormals does.
+    glm::vec3 normal(0.0f);
+    int current = edge;
+    do {
+      const int prev = NextHalfedge(NextHalfedge(current));
+      const glm::vec3 out =
+          glm::normalize(vertPos[halfedges[current].endVert] - pos);
+      const glm::vec3 in =
+          glm::normalize(vertPos[halfedges[prev].startVert] - pos);
+      const float dot = glm::dot(out, in);
+      const float phi =
+          dot >= 1 ? 0 : (dot <= -1 ? glm::pi<float>() : glm::acos(dot));
+      normal += phi * faceNormal[current / 3];
+      current = NextHalfedge(halfedges[current].pairedHalfedge);
+    } while (current != edge);
+    vertNormal[vert] = SafeNormalize(normal);
+  }
+};
+
 struct Tri2Halfedges {
   Halfedge* halfedges;
   TmpEdge* edges;
@@ -134,6 +169,23 @@ struct LinkHalfedges {
   }
 };
 
+struct EdgeKey {
+  __host__ __device__ uint64_t operator()(const TmpEdge& edge) {
+    return (static_cast<uint64_t>(edge.first) << 32) | edge.second;
+  }
+};
+
+struct DuplicateEdge {
+  const TmpEdge* edges;
+
+  __host__ __device__ bool operator()(int k) {
+    const TmpEdge& thisEdge = edges[2 * k];
+    const TmpEdge& lastEdge = edges[2 * k - 2];
+    return thisEdge.first == lastEdge.first &&
+           thisEdge.second == lastEdge.second;
+  }
+};
+
 struct SwapHalfedges {
   Halfedge* halfedges;
   const TmpEdge* edges;
@@ -184,6 +236,18 @@ struct InitializeBaryRef {
   }
 };
 
+struct MeshIDOf {
+  __host__ __device__ int operator()(const BaryRef& ref) { return ref.meshID; }
+};
+
+struct RemapMeshID {
+  const int firstNewID;
+
+  __host__ __device__ void operator()(thrust::tuple<BaryRef&, int> inOut) {
+    thrust::get<0>(inOut).meshID = firstNewID + thrust::get<1>(inOut);
+  }
+};
+
 struct CheckProperties {
   const int numSets;
 
@@ -273,6 +337,114 @@ struct CoplanarEdge {
   }
 };
 
+/**
+ * Picks the larger of two triangles, breaking ties by the lower index so that
+ * the reduction is independent of order.
+ */
+struct LargerTri {
+  const float* triArea;
+
+  __host__ __device__ int operator()(int tri0, int tri1) const {
+    const float area0 = triArea[tri0];
+    const float area1 = triArea[tri1];
+    return area1 > area0 || (area1 == area0 && tri1 < tri0) ? tri1 : tri0;
+  }
+};
+
+struct NeedsBary {
+  const int* triRef;
+  const Halfedge* halfedge;
+
+  __host__ __device__ bool operator()(int corner) {
+    const int tri = corner / 3;
+    const int refTri = triRef[tri];
+    if (refTri == tri) return false;
+    const int vert = halfedge[corner].startVert;
+    for (int i : {0, 1, 2}) {
+      if (halfedge[3 * refTri + i].startVert == vert) return false;
+    }
+    return true;
+  }
+};
+
+struct BaryKey {
+  const int* triRef;
+  const Halfedge* halfedge;
+
+  __host__ __device__ void operator()(
+      thrust::tuple<thrust::pair<int, int>&, int> inOut) {
+    const int corner = thrust::get<1>(inOut);
+    thrust::get<0>(inOut) =
+        thrust::make_pair(triRef[corner / 3], halfedge[corner].startVert);
+  }
+};
+
+struct IsNewKey {
+  const thrust::pair<int, int>* keys;
+
+  __host__ __device__ int operator()(int i) {
+    return i > 0 && keys[i] != keys[i - 1];
+  }
+};
+
+struct KeyBary {
+  const Halfedge* halfedge;
+  const glm::vec3* vertPos;
+  const float precision;
+
+  __host__ __device__ void operator()(
+      thrust::tuple<glm::vec3&, int&, thrust::pair<int, int>> inOut) {
+    const thrust::pair<int, int> key = thrust::get<2>(inOut);
+    glm::mat3 triPos;
+    for (int i : {0, 1, 2}) {
+      triPos[i] = vertPos[halfedge[3 * key.first + i].startVert];
+    }
+    const glm::vec3 uvw = GetBarycentric(vertPos[key.second], triPos, precision);
+    thrust::get<0>(inOut) = uvw;
+    thrust::get<1>(inOut) = !isnan(uvw[0]);
+  }
+};
+
+struct AssignBary {
+  int* cornerBary;
+  const int* isCoplanar;
+  const int* key2bary;
+
+  __host__ __device__ void operator()(thrust::tuple<int, int> in) {
+    const int corner = thrust::get<0>(in);
+    const int key = thrust::get<1>(in);
+    cornerBary[corner] = isCoplanar[key] ? key2bary[key] : -4;
+  }
+};
+
+struct CoplanarRef {
+  const int* triRef;
+  const int* cornerBary;
+  const Halfedge* halfedge;
+
+  __host__ __device__ void operator()(thrust::tuple<BaryRef&, int> inOut) {
+    BaryRef& baryRef = thrust::get<0>(inOut);
+    const int tri = thrust::get<1>(inOut);
+    const int refTri = triRef[tri];
+    if (refTri == tri) return;
+
+    glm::ivec3 vertBary;
+    for (int i : {0, 1, 2}) {
+      const int vert = halfedge[3 * tri + i].startVert;
+      int bary = cornerBary[3 * tri + i];
+      for (int j : {0, 1, 2}) {
+        if (halfedge[3 * refTri + j].startVert == vert) bary = j - 3;
+      }
+      // A vert that is not coplanar with the reference leaves this triangle as
+      // its own reference.
+      if (bary < -3) return;
+      vertBary[i] = bary;
+    }
+    baryRef.tri = refTri;
+    baryRef.vertBary = vertBary;
+  }
+};
+
 struct EdgeBox {
   const glm::vec3* vertPos;
 
@@ -282,11 +454,61 @@ struct EdgeBox {
     thrust::get<0>(inout) = Box(vertPos[edge.first], vertPos[edge.second]);
   }
 };
+
+struct FaceTmpEdges {
+  TmpEdge* edges;
+  const Halfedge* halfedge;
+
+  __host__ __device__ void operator()(thrust::tuple<int, int> in) {
+    const int idx = thrust::get<0>(in);
+    const int face = thrust::get<1>(in);
+    for (const int i : {0, 1, 2}) {
+      const int edge = 3 * face + i;
+      const Halfedge& h = halfedge[edge];
+      edges[3 * idx + i] =
+          TmpEdge(h.startVert, h.endVert, h.IsForward() ? edge : -1);
+    }
+  }
+};
+
+struct FaceVerts {
+  int* verts;
+  const Halfedge* halfedge;
+
+  __host__ __device__ void operator()(thrust::tuple<int, int> in) {
+    const int idx = thrust::get<0>(in);
+    const int face = thrust::get<1>(in);
+    for (const int i : {0, 1, 2}) {
+      verts[3 * idx + i] = halfedge[3 * face + i].startVert;
+    }
+  }
+};
+
+struct ReindexVert {
+  const int* vertIdx;
+
+  __host__ __device__ void operator()(int& vert) { vert = vertIdx[vert]; }
+};
+
+SparseIndices EdgeBoxCollisions(const Collider& collider,
+                                const VecDH<TmpEdge>& edges,
+                                const VecDH<glm::vec3>& vertPos) {
+  const int numEdge = edges.size();
+  VecDH<Box> edgeBB(numEdge);
+  thrust::for_each_n(zip(edgeBB.beginD(), edges.cbeginD()), numEdge,
+                     EdgeBox({vertPos.cptrD()}));
+
+  SparseIndices q1p2 = collider.Collisions(edgeBB);
+
+  thrust::for_each(q1p2.beginD(0), q1p2.endD(0), ReindexEdge({edges.cptrD()}));
+  return q1p2;
+}
 }  // namespace
 
 namespace manifold {
 
 std::vector<int> Manifold::Impl::meshID2Original_;
+std::mutex Manifold::Impl::meshIDMutex_;
 
 /**
  * Create a manifold from an input triangle Mesh. Will throw if the Mesh is not
@@ -296,11 +518,61 @@ Manifold::Impl::Impl(const Mesh& mesh,
                      const std::vector<glm::ivec3>& triProperties,
                      const std::vector<float>& properties,
                      const std::vector<float>& propertyTolerance)
-    : vertPos_(mesh.vertPos), halfedgeTangent_(mesh.halfedgeTangent) {
+    : Impl(mesh.vertPos, mesh.triVerts, mesh.halfedgeTangent, triProperties,
+           properties, propertyTolerance) {}
+
+/**
+ * Create a manifold from the caller's buffers, which are each copied once
+ * straight into this manifold's arrays.
+ */
+Manifold::Impl::Impl(VecView<glm::vec3> vertPos, VecView<glm::ivec3> triVerts,
+                     VecView<glm::vec4> halfedgeTangent,
+                     const std::vector<glm::ivec3>& triProperties,
+                     const std::vector<float>& properties,
+                     const std::vector<float>& propertyTolerance)
+    : vertPos_(vertPos.begin(), vertPos.end()),
+      halfedgeTangent_(halfedgeTangent.begin(), halfedgeTangent.end()) {
   CheckDevice();
   CalculateBBox();
   SetPrecision();
-  CreateAndFixHalfedges(mesh.triVerts);
+  CreateAndFixHalfedges(VecDH<glm::ivec3>(triVerts.begin(), triVerts.end()));
+  InitializeFromHalfedges(triProperties, properties, propertyTolerance);
+}
+
+/**
+ * Create a manifold from a Mesh that is no longer needed. Each of its arrays is
+ * freed as soon as it has been copied, which lowers the peak memory use, and
+ * the Mesh is left empty.
+ */
+Manifold::Impl::Impl(Mesh&& mesh, const std::vector<glm::ivec3>& triProperties,
+                     const std::vector<float>& properties,
+                     const std::vector<float>& propertyTolerance)
+    : vertPos_(mesh.vertPos.data(), mesh.vertPos.data() + mesh.vertPos.size()),
+      halfedgeTangent_(
+          mesh.halfedgeTangent.data(),
+          mesh.halfedgeTangent.data() + mesh.halfedgeTangent.size()) {
+  std::vector<glm::vec3>().swap(mesh.vertPos);
+  std::vector<glm::vec3>().swap(mesh.vertNormal);
+  std::vector<glm::vec4>().swap(mesh.halfedgeTangent);
+  CheckDevice();
+  CalculateBBox();
+  SetPrecision();
+  {
+    VecDH<glm::ivec3> triVerts(mesh.triVerts.data(),
+                               mesh.triVerts.data() + mesh.triVerts.size());
+    std::vector<glm::ivec3>().swap(mesh.triVerts);
+    CreateAndFixHalfedges(triVerts);
+  }
+  InitializeFromHalfedges(triProperties, properties, propertyTolerance);
+}
+
+/**
+ * Completes the construction of a manifold once its halfedges are built.
+ */
+void Manifold::Impl::InitializeFromHalfedges(
+    const std::vector<glm::ivec3>& triProperties,
+    const std::vector<float>& properties,
+    const std::vector<float>& propertyTolerance) {
   CalculateNormals();
   InitializeNewReference(triProperties, properties, propertyTolerance);
   CollapseDegenerates();
@@ -362,17 +634,39 @@ Manifold::Impl::Impl(Shape shape) {
 /**
  * When a manifold is copied, it is given a new unique set of mesh relation IDs,
  * identifying a particular instance of a copied input mesh. The original mesh
- * ID can be found using the meshID2Original mapping.
+ * ID can be found using the meshID2Original mapping. The distinct IDs are
+ * sorted and given a contiguous block of new IDs in that order, so each
+ * triangle is remapped by a binary search of them.
  */
 void Manifold::Impl::DuplicateMeshIDs() {
-  std::map<int, int> old2new;
-  for (BaryRef& ref : meshRelation_.triBary) {
-    if (old2new.find(ref.meshID) == old2new.end()) {
-      old2new[ref.meshID] = meshID2Original_.size();
-      meshID2Original_.push_back(meshID2Original_[ref.meshID]);
+  const int numTri = meshRelation_.triBary.size();
+  if (numTri == 0) return;
+  VecDH<int> triMeshID(numTri);
+  thrust::transform(meshRelation_.triBary.beginD(),
+                    meshRelation_.triBary.endD(), triMeshID.beginD(),
+                    MeshIDOf());
+  VecDH<int> oldIDs = triMeshID;
+  thrust::sort(oldIDs.beginD(), oldIDs.endD());
+  const int numID =
+      thrust::unique(oldIDs.beginD(), oldIDs.endD()) - oldIDs.beginD();
+  oldIDs.resize(numID);
+
+  const int* oldID = oldIDs.cptrH();
+  int firstNewID;
+  {
+    std::lock_guard<std::mutex> lock(meshIDMutex_);
+    firstNewID = meshID2Original_.size();
+    meshID2Original_.resize(firstNewID + numID);
+    for (int i = 0; i < numID; ++i) {
+      meshID2Original_[firstNewID + i] = meshID2Original_[oldID[i]];
     }
-    ref.meshID = old2new[ref.meshID];
   }
+
+  VecDH<int> idIdx(numTri);
+  thrust::lower_bound(oldIDs.beginD(), oldIDs.endD(), triMeshID.beginD(),
+                      triMeshID.endD(), idIdx.beginD());
+  thrust::for_each_n(zip(meshRelation_.triBary.beginD(), idIdx.beginD()),
+                     numTri, RemapMeshID({firstNewID}));
 }
 
 void Manifold::Impl::ReinitializeReference(int meshID) {
@@ -385,8 +679,12 @@ int Manifold::Impl::InitializeNewReference(
     const std::vector<float>& properties,
     const std::vector<float>& propertyTolerance) {
   meshRelation_.triBary.resize(NumTri());
-  const int nextMeshID = meshID2Original_.size();
-  meshID2Original_.push_back(nextMeshID);
+  int nextMeshID;
+  {
+    std::lock_guard<std::mutex> lock(meshIDMutex_);
+    nextMeshID = meshID2Original_.size();
+    meshID2Original_.push_back(nextMeshID);
+  }
   ReinitializeReference(nextMeshID);
 
   const int numProps = propertyTolerance.size();
@@ -418,70 +716,77 @@ int Manifold::Impl::InitializeNewReference(
                     triPropertiesD.cptrD(), propertiesD.cptrD(),
                     propertyToleranceD.cptrD(), numProps, precision_}));
 
-  boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS> graph(
-      NumTri());
-  for (int i = 0; i < face2face.size(); ++i) {
-    const thrust::pair<int, int> edge = face2face.H()[i];
-    if (edge.first < 0) continue;
-    boost::add_edge(edge.first, edge.second, graph);
-  }
-  std::vector<int> components(NumTri());
-  const int numComponent =
-      boost::connected_components(graph, components.data());
-
-  std::vector<int> comp2tri(numComponent, -1);
-  for (int tri = 0; tri < NumTri(); ++tri) {
-    const int comp = components[tri];
-    const int current = comp2tri[comp];
-    if (current < 0 || triArea.H()[tri] > triArea.H()[current]) {
-      comp2tri[comp] = tri;
-      triArea.H()[comp] = triArea.H()[tri];
-    }
-  }
-
-  VecH<BaryRef>& triBary = meshRelation_.triBary.H();
-  std::map<std::pair<int, int>, int> triVert2bary;
-
-  for (int tri = 0; tri < NumTri(); ++tri) {
-    const int refTri = comp2tri[components[tri]];
-    if (refTri == tri) continue;
-
-    glm::mat3 triPos;
-    for (int i : {0, 1, 2}) {
-      const int vert = halfedge_.H()[3 * refTri + i].startVert;
-      triPos[i] = vertPos_.H()[vert];
-      triVert2bary[{refTri, vert}] = i - 3;
-    }
-
-    glm::ivec3 vertBary;
-    bool coplanar = true;
-    for (int i : {0, 1, 2}) {
-      const int vert = halfedge_.H()[3 * tri + i].startVert;
-      if (triVert2bary.find({refTri, vert}) == triVert2bary.end()) {
-        const glm::vec3 uvw =
-            GetBarycentric(vertPos_.H()[vert], triPos, precision_);
-        if (isnan(uvw[0])) {
-          coplanar = false;
-          triVert2bary[{refTri, vert}] = -4;
-          break;
-        }
-        triVert2bary[{refTri, vert}] = meshRelation_.barycentric.size();
-        meshRelation_.barycentric.H().push_back(uvw);
-      }
-      const int bary = triVert2bary[{refTri, vert}];
-      if (bary < -3) {
-        coplanar = false;
-        break;
-      }
-      vertBary[i] = bary;
-    }
-
-    if (coplanar) {
-      BaryRef& ref = triBary[tri];
-      ref.tri = refTri;
-      ref.vertBary = vertBary;
-    }
-  }
+  VecDH<int> components;
+  LabelComponents(components, face2face, NumTri());
+
+  // The reference of each coplanar component is its largest triangle.
+  VecDH<int> sortedComp(components);
+  VecDH<int> compTri(NumTri());
+  thrust::sequence(compTri.beginD(), compTri.endD());
+  thrust::sort_by_key(sortedComp.beginD(), sortedComp.endD(),
+                      compTri.beginD());
+  VecDH<int> compRoot(NumTri());
+  VecDH<int> compRef(NumTri());
+  const int numComp =
+      thrust::reduce_by_key(sortedComp.beginD(), sortedComp.endD(),
+                            compTri.beginD(), compRoot.beginD(),
+                            compRef.beginD(), thrust::equal_to<int>(),
+                            LargerTri({triArea.cptrD()}))
+          .first -
+      compRoot.beginD();
+  VecDH<int> root2ref(NumTri());
+  thrust::scatter(compRef.beginD(), compRef.beginD() + numComp,
+                  compRoot.beginD(), root2ref.beginD());
+  VecDH<int> triRef(NumTri());
+  thrust::gather(components.beginD(), components.endD(), root2ref.beginD(),
+                 triRef.beginD());
+
+  // Each vert of a triangle that is not one of its reference's verts needs
+  // barycentric coordinates. These are deduplicated by sorting on the
+  // (refTri, vert) pair, so that each is calculated once.
+  VecDH<int> corners(halfedge_.size());
+  const int numCorner =
+      thrust::copy_if(countAt(0), countAt(halfedge_.size()), corners.beginD(),
+                      NeedsBary({triRef.cptrD(), halfedge_.cptrD()})) -
+      corners.beginD();
+  corners.resize(numCorner);
+  VecDH<thrust::pair<int, int>> keys(numCorner);
+  thrust::for_each_n(zip(keys.beginD(), corners.beginD()), numCorner,
+                     BaryKey({triRef.cptrD(), halfedge_.cptrD()}));
+  thrust::sort_by_key(keys.beginD(), keys.endD(), corners.beginD());
+
+  VecDH<int> keyIdx(numCorner);
+  thrust::transform(countAt(0), countAt(numCorner), keyIdx.beginD(),
+                    IsNewKey({keys.cptrD()}));
+  thrust::inclusive_scan(keyIdx.beginD(), keyIdx.endD(), keyIdx.beginD());
+  const int numKey =
+      thrust::unique(keys.beginD(), keys.endD()) - keys.beginD();
+
+  VecDH<glm::vec3> barycentric(numKey);
+  VecDH<int> isCoplanar(numKey);
+  thrust::for_each_n(
+      zip(barycentric.beginD(), isCoplanar.beginD(), keys.beginD()), numKey,
+      KeyBary({halfedge_.cptrD(), vertPos_.cptrD(), precision_}));
+  VecDH<int> key2bary(numKey);
+  thrust::exclusive_scan(isCoplanar.beginD(), isCoplanar.endD(),
+                         key2bary.beginD());
+  // All triBary were just reinitialized, so no old barycentrics are in use.
+  meshRelation_.barycentric.resize(numKey);
+  const int numBary =
+      thrust::copy_if(barycentric.beginD(), barycentric.endD(),
+                      isCoplanar.beginD(),
+                      meshRelation_.barycentric.beginD(),
+                      thrust::identity<int>()) -
+      meshRelation_.barycentric.beginD();
+  meshRelation_.barycentric.resize(numBary);
+
+  VecDH<int> cornerBary(halfedge_.size(), 0);
+  thrust::for_each_n(
+      zip(corners.beginD(), keyIdx.beginD()), numCorner,
+      AssignBary({cornerBary.ptrD(), isCoplanar.cptrD(), key2bary.cptrD()}));
+  thrust::for_each_n(zip(meshRelation_.triBary.beginD(), countAt(0)), NumTri(),
+                     CoplanarRef({triRef.cptrD(), cornerBary.cptrD(),
+                                  halfedge_.cptrD()}));
 
   return nextMeshID;
 }
@@ -509,31 +814,54 @@ void Manifold::Impl::CreateAndFixHalfedges(const VecDH<glm::ivec3>& triVerts) {
   const int numTri = triVerts.size();
   halfedge_.resize(3 * numTri);
   VecDH<TmpEdge> edge(3 * numTri);
-  thrust::for_each_n(zip(countAt(0), triVerts.begin()), numTri,
-                     Tri2Halfedges({halfedge_.ptrH(), edge.ptrH()}));
+  thrust::for_each_n(zip(countAt(0), triVerts.beginD()), numTri,
+                     Tri2Halfedges({halfedge_.ptrD(), edge.ptrD()}));
+  PairHalfedges(edge);
+}
+
+/**
+ * Pairs up the halfedges given by edge, which may be any subset of halfedge_
+ * in which every edge appears an even number of times, such as the faces
+ * added by a Boolean together with the halfedges they border. Identical edges
+ * of a non-2-manifold input are fixed with edge swaps.
+ */
+void Manifold::Impl::PairHalfedges(VecDH<TmpEdge>& edge) {
   // Stable sort is required here so that halfedges from the same face are
   // paired together (the triangles were created in face order). In some
   // degenerate situations the triangulator can add the same internal edge in
   // two different faces, causing this edge to not be 2-manifold. We detect this
   // and fix it by swapping one of the identical edges, so it is important that
-  // we have the edges paired according to their face.
-  std::stable_sort(edge.begin(), edge.end());
-  thrust::for_each_n(thrust::host, countAt(0), halfedge_.size() / 2,
-                     LinkHalfedges({halfedge_.ptrH(), edge.cptrH()}));
-  thrust::for_each(thrust::host, countAt(1), countAt(halfedge_.size() / 2),
+  // we have the edges paired according to their face. Sorting on a 64-bit key
+  // of the vert pair allows a parallel radix sort.
+  VecDH<uint64_t> key(edge.size());
+  thrust::transform(edge.beginD(), edge.endD(), key.beginD(), EdgeKey());
+  thrust::stable_sort_by_key(key.beginD(), key.endD(), edge.beginD());
+  thrust::for_each_n(countAt(0), edge.size() / 2,
+                     LinkHalfedges({halfedge_.ptrD(), edge.cptrD()}));
+
+  // Each swap changes the halfedges the next one reads, so the duplicates,
+  // which are rare, are found in parallel and then fixed in order on the host.
+  VecDH<int> duplicate(edge.size() / 2);
+  const int numDuplicate =
+      thrust::copy_if(countAt(1), countAt(edge.size() / 2),
+                      duplicate.beginD(), DuplicateEdge({edge.cptrD()})) -
+      duplicate.beginD();
+  if (numDuplicate == 0) return;
+  duplicate.resize(numDuplicate);
+  thrust::for_each(thrust::host, duplicate.begin(), duplicate.end(),
                    SwapHalfedges({halfedge_.ptrH(), edge.cptrH()}));
 }
 
 /**
  * Does a full recalculation of the face bounding boxes, including updating the
- * collider, but does not resort the faces.
+ * collider. The faces are not resorted unless the vertices have moved far
+ * enough to degrade the collider, in which case it is rebuilt.
  */
 void Manifold::Impl::Update() {
   CalculateBBox();
   VecDH<Box> faceBox;
-  VecDH<uint32_t> faceMorton;
-  GetFaceBoxMorton(faceBox, faceMorton);
-  collider_.UpdateBoxes(faceBox);
+  GetFaceBox(faceBox);
+  if (!collider_.UpdateBoxes(faceBox)) SortFacesAndBuildCollider();
 }
 
 void Manifold::Impl::ApplyTransform() const {
@@ -612,6 +940,19 @@ void Manifold::Impl::CalculateNormals() {
   thrust::for_each(vertNormal_.beginD(), vertNormal_.endD(), Normalize());
 }
 
+/**
+ * Recalculates the normals of only the verts of the faces from firstFace on,
+ * which must already have their face normals, by walking the faces around each
+ * of them. This keeps the vert normals up to date after a local edit that
+ * appended these faces, without visiting the rest of the mesh.
+ */
+void Manifold::Impl::CalculateNormals(int firstFace) {
+  vertNormal_.resize(NumVert());
+  thrust::for_each(countAt(3 * firstFace), countAt(halfedge_.size()),
+                   FanNormal({vertNormal_.ptrD(), vertPos_.cptrD(),
+                              halfedge_.cptrD(), faceNormal_.cptrD()}));
+}
+
 /**
  * Returns a sparse array of the bounding box overlaps between the edges of the
  * input manifold, Q and the faces of this manifold. Returned indices only
@@ -619,15 +960,25 @@ void Manifold::Impl::CalculateNormals() {
  */
 SparseIndices Manifold::Impl::EdgeCollisions(const Impl& Q) const {
   VecDH<TmpEdge> edges = CreateTmpEdges(Q.halfedge_);
-  const int numEdge = edges.size();
-  VecDH<Box> QedgeBB(numEdge);
-  thrust::for_each_n(zip(QedgeBB.beginD(), edges.cbeginD()), numEdge,
-                     EdgeBox({Q.vertPos_.cptrD()}));
-
-  SparseIndices q1p2 = collider_.Collisions(QedgeBB);
+  return EdgeBoxCollisions(collider_, edges, Q.vertPos_);
+}
 
-  thrust::for_each(q1p2.beginD(0), q1p2.endD(0), ReindexEdge({edges.cptrD()}));
-  return q1p2;
+/**
+ * As above, but only for the edges of the given faces of Q. Each edge is only
+ * tested from the face of its forward halfedge, so this finds every overlap of
+ * an edge whose two faces are both in the list.
+ */
+SparseIndices Manifold::Impl::EdgeCollisions(const Impl& Q,
+                                             const VecDH<int>& facesQ) const {
+  const int numFace = facesQ.size();
+  VecDH<TmpEdge> edges(3 * numFace);
+  thrust::for_each_n(zip(countAt(0), facesQ.beginD()), numFace,
+                     FaceTmpEdges({edges.ptrD(), Q.halfedge_.cptrD()}));
+  const int numEdge =
+      thrust::remove_if(edges.beginD(), edges.endD(), TmpInvalid()) -
+      edges.beginD();
+  edges.resize(numEdge);
+  return EdgeBoxCollisions(collider_, edges, Q.vertPos_);
 }
 
 /**
@@ -638,4 +989,45 @@ SparseIndices Manifold::Impl::VertexCollisionsZ(
     const VecDH<glm::vec3>& vertsIn) const {
   return collider_.Collisions(vertsIn);
 }
+
+/**
+ * As above, but only for the input vertices listed in vertIdx. The returned
+ * indices still refer to vertsIn.
+ */
+SparseIndices Manifold::Impl::VertexCollisionsZ(
+    const VecDH<glm::vec3>& vertsIn, const VecDH<int>& vertIdx) const {
+  VecDH<glm::vec3> verts(vertIdx.size());
+  thrust::gather(vertIdx.beginD(), vertIdx.endD(), vertsIn.beginD(),
+                 verts.beginD());
+  SparseIndices p0q2 = collider_.Collisions(verts);
+  thrust::for_each(p0q2.beginD(0), p0q2.endD(0),
+                   ReindexVert({vertIdx.cptrD()}));
+  return p0q2;
+}
+
+/**
+ * Returns the sorted faces of this manifold whose bounding boxes overlap the
+ * given box, found with a single query of the collider.
+ */
+VecDH<int> Manifold::Impl::PatchFaces(const Box& box) const {
+  SparseIndices query2face = collider_.Collisions(VecDH<Box>(1, box));
+  VecDH<int> faces = query2face.Copy(true);
+  thrust::sort(faces.beginD(), faces.endD());
+  return faces;
+}
+
+/**
+ * Returns the sorted, unique vertices of the given faces.
+ */
+VecDH<int> Manifold::Impl::PatchVerts(const VecDH<int>& faces) const {
+  const int numFace = faces.size();
+  VecDH<int> verts(3 * numFace);
+  thrust::for_each_n(zip(countAt(0), faces.beginD()), numFace,
+                     FaceVerts({verts.ptrD(), halfedge_.cptrD()}));
+  thrust::sort(verts.beginD(), verts.endD());
+  const int numVert =
+      thrust::unique(verts.beginD(), verts.endD()) - verts.beginD();
+  verts.resize(numVert);
+  return verts;
+}
 }  // namespace manifold
\ No newline at end of file
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #pragma once
+#include <mutex>
+
 #include "collider.cuh"
 #include "manifold.h"
 #include "shared.cuh"
@@ -41,6 +43,8 @@ struct Manifold::Impl {
   glm::mat4x3 transform_ = glm::mat4x3(1.0f);
 
   static std::vector<int> meshID2Original_;
+  // Guards meshID2Original_, so that manifolds can be built concurrently.
+  static std::mutex meshIDMutex_;
 
   Impl() {}
   enum class Shape { TETRAHEDRON, CUBE, OCTAHEDRON };
@@ -50,6 +54,17 @@ struct Manifold::Impl {
        const std::vector<glm::ivec3>& triProperties = std::vector<glm::ivec3>(),
        const std::vector<float>& properties = std::vector<float>(),
        const std::vector<float>& propertyTolerance = std::vector<float>());
+  Impl(Mesh&&, const std::vector<glm::ivec3>& triProperties,
+       const std::vector<float>& properties,
+       const std::vector<float>& propertyTolerance);
+  Impl(VecView<glm::vec3> vertPos, VecView<glm::ivec3> triVerts,
+       VecView<glm::vec4> halfedgeTangent,
+       const std::vector<glm::ivec3>& triProperties,
+       const std::vector<float>& properties,
+       const std::vector<float>& propertyTolerance);
+  void InitializeFromHalfedges(const std::vector<glm::ivec3>& triProperties,
+                               const std::vector<float>& properties,
+                               const std::vector<float>& propertyTolerance);
 
   int InitializeNewReference(
       const std::vector<glm::ivec3>& triProperties = std::vector<glm::ivec3>(),
@@ -60,13 +75,20 @@ struct Manifold::Impl {
   void ReinitializeReference(int meshID = -1);
   void CreateHalfedges(const VecDH<glm::ivec3>& triVerts);
   void CreateAndFixHalfedges(const VecDH<glm::ivec3>& triVerts);
+  void PairHalfedges(VecDH<TmpEdge>& edge);
   void CalculateNormals();
+  void CalculateNormals(int firstFace);
 
   void Update();
   void ApplyTransform() const;
   void ApplyTransform();
   SparseIndices EdgeCollisions(const Impl& B) const;
+  SparseIndices EdgeCollisions(const Impl& B, const VecDH<int>& facesB) const;
   SparseIndices VertexCollisionsZ(const VecDH<glm::vec3>& vertsIn) const;
+  SparseIndices VertexCollisionsZ(const VecDH<glm::vec3>& vertsIn,
+                                  const VecDH<int>& vertIdx) const;
+  VecDH<int> PatchFaces(const Box& box) const;
+  VecDH<int> PatchVerts(const VecDH<int>& faces) const;
 
   bool IsEmpty() const { return NumVert() == 0; }
   int NumVert() const { return vertPos_.size(); }
@@ -74,6 +96,7 @@ struct Manifold::Impl {
   int NumTri() const { return halfedge_.size() / 3; }
   // properties.cu
   Properties GetProperties() const;
+  Properties GetPolygonProperties(const VecDH<int>& faceEdge) const;
   Curvature GetCurvature() const;
   void CalculateBBox();
   void SetPrecision(float minPrecision = -1);
@@ -83,21 +106,29 @@ struct Manifold::Impl {
 
   // sort.cu
   void Finish();
+  int FinishEdit(int firstNewFace);
   void SortVerts();
   void ReindexVerts(const VecDH<int>& vertNew2Old, int numOldVert);
-  void GetFaceBoxMorton(VecDH<Box>& faceBox, VecDH<uint32_t>& faceMorton) const;
-  void SortFaces(VecDH<Box>& faceBox, VecDH<uint32_t>& faceMorton);
+  void GetFaceBox(VecDH<Box>& faceBox) const;
+  template <typename T>
+  void GetFaceBoxMorton(VecDH<Box>& faceBox, VecDH<T>& faceMorton) const;
+  template <typename T>
+  void SortFaces(VecDH<Box>& faceBox, VecDH<T>& faceMorton);
+  void SortFacesAndBuildCollider();
   void GatherFaces(const VecDH<int>& faceNew2Old);
   void GatherFaces(const Impl& old, const VecDH<int>& faceNew2Old);
 
   // face_op.cu
   void Face2Tri(const VecDH<int>& faceEdge, const VecDH<BaryRef>& faceRef,
                 const VecDH<int>& halfedgeBary);
+  VecDH<glm::ivec3> TriangulateFaces(const VecDH<int>& faceEdge,
+                                     const VecDH<BaryRef>& faceRef,
+                                     const VecDH<int>& halfedgeBary);
   Polygons Face2Polygons(int face, glm::mat3x2 projection,
                          const VecH<int>& faceEdge) const;
 
   // edge_op.cu
-  void CollapseDegenerates();
+  void CollapseDegenerates(int firstEdge = 0);
   void CollapseEdge(int edge);
   void RecursiveEdgeSwap(int edge);
   void RemoveIfFolded(int edge);
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <map>
+
 #include "boolean3.cuh"
 #include "impl.cuh"
 
@@ -32,6 +35,23 @@ struct MakeTri {
   }
 };
 
+constexpr int kWarpBatch = 1 << 12;
+
+constexpr uint32_t kSerialMagic = 0x464E414D;  // "MANF" in little-endian
+constexpr uint32_t kSerialVersion = 1;
+
+struct WarpBatch {
+  const std::function<void(glm::vec3*, size_t)>* warpFunc;
+  glm::vec3* vertPos;
+  const int numVert;
+
+  __host__ void operator()(int batch) {
+    const int start = batch * kWarpBatch;
+    const int size = glm::min(kWarpBatch, numVert - start);
+    (*warpFunc)(vertPos + start, size);
+  }
+};
+
 struct GetMeshID {
   __host__ __device__ void operator()(thrust::tuple<int&, BaryRef> inOut) {
     thrust::get<0>(inOut) = thrust::get<1>(inOut).meshID;
@@ -60,6 +80,28 @@ Manifold::Manifold(const Mesh& mesh,
                    const std::vector<float>& propertyTolerance)
     : pImpl_{std::make_unique<Impl>(mesh, triProperties, properties,
                                     propertyTolerance)} {}
+
+/**
+ * Create a manifold from a Mesh that is no longer needed, freeing each of its
+ * arrays as soon as it has been copied. The Mesh is left empty.
+ */
+Manifold::Manifold(Mesh&& mesh, const std::vector<glm::ivec3>& triProperties,
+                   const std::vector<float>& properties,
+                   const std::vector<float>& propertyTolerance)
+    : pImpl_{std::make_unique<Impl>(std::move(mesh), triProperties, properties,
+                                    propertyTolerance)} {}
+
+/**
+ * Create a manifold directly from caller-owned vertex position and triangle
+ * index buffers, without first gathering them into a Mesh.
+ */
+Manifold::Manifold(VecView<glm::vec3> vertPos, VecView<glm::ivec3> triVerts,
+                   const std::vector<glm::ivec3>& triProperties,
+                   const std::vector<float>& properties,
+                   const std::vector<float>& propertyTolerance)
+    : pImpl_{std::make_unique<Impl>(vertPos, triVerts, VecView<glm::vec4>(),
+                                    triProperties, properties,
+                                    propertyTolerance)} {}
 Manifold::~Manifold() = default;
 Manifold::Manifold(Manifold&&) noexcept = default;
 Manifold& Manifold::operator=(Manifold&&) noexcept = default;
@@ -99,6 +141,150 @@ Mesh Manifold::GetMesh() const {
   return result;
 }
 
+/**
+ * This returns a MeshView that references this manifold's own arrays instead
+ * of copying them as GetMesh() does, so it is cheap to call repeatedly. The
+ * triangles are read directly from the halfedges. The view is only valid until
+ * this manifold is next modified or destroyed.
+ */
+MeshView Manifold::GetMeshView() const {
+  pImpl_->ApplyTransform();
+  const Impl& impl = *pImpl_;
+  static_assert(sizeof(Halfedge) % sizeof(int) == 0,
+                "Halfedge must be a whole number of ints to stride over.");
+
+  MeshView view;
+  view.vertPos = VecView<glm::vec3>(impl.vertPos_.cptrH(), NumVert());
+  view.vertNormal =
+      VecView<glm::vec3>(impl.vertNormal_.cptrH(), impl.vertNormal_.size());
+  view.halfedgeTangent = VecView<glm::vec4>(impl.halfedgeTangent_.cptrH(),
+                                            impl.halfedgeTangent_.size());
+  // startVert is the first member of Halfedge.
+  view.triVerts =
+      TriView(reinterpret_cast<const int*>(impl.halfedge_.cptrH()),
+              sizeof(Halfedge) / sizeof(int), NumTri());
+  return view;
+}
+
+/**
+ * Writes a binary snapshot of this manifold, including its halfedges, normals,
+ * mesh relation and collider, so that Deserialize can reload it without
+ * recomputing any of them. The format is versioned, but uses native byte order
+ * and struct layout, so it is suited to caches rather than interchange.
+ */
+void Manifold::Serialize(std::ostream& stream) const {
+  pImpl_->ApplyTransform();
+  const Impl& impl = *pImpl_;
+  WriteValue(stream, kSerialMagic);
+  WriteValue(stream, kSerialVersion);
+  WriteValue(stream, impl.bBox_);
+  WriteValue(stream, impl.precision_);
+  WriteVec(stream, impl.vertPos_);
+  WriteVec(stream, impl.halfedge_);
+  WriteVec(stream, impl.vertNormal_);
+  WriteVec(stream, impl.faceNormal_);
+  WriteVec(stream, impl.halfedgeTangent_);
+  WriteVec(stream, impl.meshRelation_.barycentric);
+  WriteVec(stream, impl.meshRelation_.triBary);
+
+  // MeshIDs only have meaning within this process, so each is stored with its
+  // original, to be reassigned on load.
+  std::vector<glm::ivec2> meshIDOriginal;
+  const std::vector<int> meshIDs = GetMeshIDs();
+  {
+    std::lock_guard<std::mutex> lock(Impl::meshIDMutex_);
+    for (const int meshID : meshIDs) {
+      meshIDOriginal.push_back({meshID, Impl::meshID2Original_[meshID]});
+    }
+  }
+  WriteVec(stream, VecDH<glm::ivec2>(meshIDOriginal));
+  impl.collider_.Serialize(stream);
+  ALWAYS_ASSERT(!stream.fail(), userErr, "Failed to write serialized data.");
+}
+
+/**
+ * Reads a manifold written by Serialize. The meshes it references get new
+ * meshIDs and originals, as a copy would, with the same relationships between
+ * them as when they were written.
+ */
+Manifold Manifold::Deserialize(std::istream& stream) {
+  uint32_t magic, version;
+  ReadValue(stream, magic);
+  ReadValue(stream, version);
+  ALWAYS_ASSERT(magic == kSerialMagic, userErr, "Not a serialized Manifold.");
+  ALWAYS_ASSERT(version == kSerialVersion, userErr,
+                "Unsupported serialized Manifold version.");
+
+  Manifold out;
+  Impl& impl = *out.pImpl_;
+  ReadValue(stream, impl.bBox_);
+  ReadValue(stream, impl.precision_);
+  ReadVec(stream, impl.vertPos_);
+  ReadVec(stream, impl.halfedge_);
+  ReadVec(stream, impl.vertNormal_);
+  ReadVec(stream, impl.faceNormal_);
+  ReadVec(stream, impl.halfedgeTangent_);
+  ReadVec(stream, impl.meshRelation_.barycentric);
+  ReadVec(stream, impl.meshRelation_.triBary);
+  VecDH<glm::ivec2> meshIDOriginal;
+  ReadVec(stream, meshIDOriginal);
+  ALWAYS_ASSERT(impl.halfedge_.size() % 3 == 0, userErr,
+                "Serialized Manifold is inconsistent.");
+  const int numTri = impl.NumTri();
+  impl.collider_.Deserialize(stream, numTri);
+
+  // Every index is checked, so that corrupt data throws here rather than being
+  // followed out of bounds later.
+  const int numVert = impl.NumVert();
+  const int numHalfedge = impl.halfedge_.size();
+  const int numBary = impl.meshRelation_.barycentric.size();
+  const VecH<Halfedge>& halfedge = impl.halfedge_.H();
+  const VecH<BaryRef>& triBary = impl.meshRelation_.triBary.H();
+  ALWAYS_ASSERT(
+      impl.vertNormal_.size() == numVert &&
+          impl.faceNormal_.size() == numTri && triBary.size() == numTri &&
+          (impl.halfedgeTangent_.size() == 0 ||
+           impl.halfedgeTangent_.size() == numHalfedge) &&
+          std::all_of(halfedge.begin(), halfedge.end(),
+                      [&](const Halfedge& edge) {
+                        return edge.startVert >= 0 &&
+                               edge.startVert < numVert &&
+                               edge.endVert >= 0 && edge.endVert < numVert &&
+                               edge.pairedHalfedge >= 0 &&
+                               edge.pairedHalfedge < numHalfedge;
+                      }) &&
+          std::all_of(triBary.begin(), triBary.end(),
+                      [&](const BaryRef& ref) {
+                        for (const int i : {0, 1, 2}) {
+                          if (ref.vertBary[i] < -3 ||
+                              ref.vertBary[i] >= numBary)
+                            return false;
+                        }
+                        return true;
+                      }),
+      userErr, "Serialized Manifold is inconsistent.");
+
+  std::map<int, int> original2new;
+  std::map<int, int> old2new;
+  std::unique_lock<std::mutex> lock(Impl::meshIDMutex_);
+  for (const glm::ivec2& ids : meshIDOriginal.H()) {
+    if (original2new.find(ids[1]) == original2new.end()) {
+      original2new[ids[1]] = Impl::meshID2Original_.size();
+      Impl::meshID2Original_.push_back(Impl::meshID2Original_.size());
+    }
+    old2new[ids[0]] = Impl::meshID2Original_.size();
+    Impl::meshID2Original_.push_back(original2new[ids[1]]);
+  }
+  lock.unlock();
+  for (BaryRef& ref : impl.meshRelation_.triBary) {
+    const auto it = old2new.find(ref.meshID);
+    ALWAYS_ASSERT(it != old2new.end(), userErr,
+                  "Serialized Manifold references an unknown meshID.");
+    ref.meshID = it->second;
+  }
+  return out;
+}
+
 int Manifold::circularSegments_ = 0;
 float Manifold::circularAngle_ = 10.0f;
 float Manifold::circularEdgeLength_ = 1.0f;
@@ -128,6 +314,12 @@ int Manifold::GetCircularSegments(float radius) {
   return nSeg;
 }
 
+Manifold::Ordering Manifold::ordering_ = Manifold::Ordering::MORTON;
+
+void Manifold::SetOrdering(Ordering ordering) {
+  Manifold::ordering_ = ordering;
+}
+
 bool Manifold::IsEmpty() const { return pImpl_->IsEmpty(); }
 int Manifold::NumVert() const { return pImpl_->NumVert(); }
 int Manifold::NumEdge() const { return pImpl_->NumEdge(); }
@@ -234,6 +426,7 @@ int Manifold::SetAsOriginal() {
 }
 
 std::vector<int> Manifold::MeshID2Original() {
+  std::lock_guard<std::mutex> lock(Impl::meshIDMutex_);
   return Manifold::Impl::meshID2Original_;
 }
 
@@ -299,6 +492,31 @@ Manifold& Manifold::Warp(std::function<void(glm::vec3&)> warpFunc) {
   return *this;
 }
 
+/**
+ * The same as the per-vertex Warp above, but the function is instead given a
+ * contiguous span of vertex positions to update, allowing the loop inside to be
+ * inlined and vectorized. The spans cover the vertices in batches, which are
+ * called concurrently on multithreaded backends, so the function must be
+ * thread-safe.
+ */
+Manifold& Manifold::Warp(std::function<void(glm::vec3*, size_t)> warpFunc) {
+  pImpl_->ApplyTransform();
+  const int numBatch = (NumVert() + kWarpBatch - 1) / kWarpBatch;
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+  // The function can only be called on the host.
+  thrust::for_each_n(thrust::host, countAt(0), numBatch,
+                     WarpBatch({&warpFunc, pImpl_->vertPos_.ptrH(), NumVert()}));
+#else
+  thrust::for_each_n(thrust::device, countAt(0), numBatch,
+                     WarpBatch({&warpFunc, pImpl_->vertPos_.ptrD(), NumVert()}));
+#endif
+  pImpl_->Update();
+  pImpl_->faceNormal_.resize(0);  // force recalculation of triNormal
+  pImpl_->CalculateNormals();
+  pImpl_->SetPrecision();
+  return *this;
+}
+
 Manifold& Manifold::Refine(int n) {
   pImpl_->Refine(n);
   return *this;
@@ -328,6 +546,31 @@ Manifold Manifold::Boolean(const Manifold& second, OpType op) const {
   return result;
 }
 
+/**
+ * Returns true if the interiors of this and second overlap, i.e. if their
+ * intersection would have non-zero volume. This is much cheaper than checking
+ * the result of operator^, as no result is built and it returns as soon as
+ * any overlap is found. Surfaces that only touch do not count.
+ */
+bool Manifold::Intersects(const Manifold& second) const {
+  pImpl_->ApplyTransform();
+  second.pImpl_->ApplyTransform();
+  return Boolean3::Intersects(*pImpl_, *second.pImpl_);
+}
+
+/**
+ * Returns the surface area and volume of Boolean(second, op) without building
+ * its mesh, which is much faster when only these are needed, for instance to
+ * score the overlap volume of two parts.
+ */
+Properties Manifold::IntersectionProperties(const Manifold& second,
+                                            OpType op) const {
+  pImpl_->ApplyTransform();
+  second.pImpl_->ApplyTransform();
+  Boolean3 boolean(*pImpl_, *second.pImpl_, op);
+  return boolean.ResultProperties(op);
+}
+
 Manifold Manifold::operator+(const Manifold& Q) const {
   return Boolean(Q, OpType::ADD);
 }
@@ -391,4 +634,74 @@ Manifold Manifold::TrimByPlane(glm::vec3 normal, float originOffset) const {
   pImpl_->ApplyTransform();
   return *this ^ Halfspace(BoundingBox(), normal, originOffset);
 }
-}  // namespace manifold
\ No newline at end of file
+
+/**
+ * Starts an edit session on a copy of body.
+ */
+EditSession::EditSession(const Manifold& body)
+    : pImpl_{std::make_unique<Manifold::Impl>(*body.pImpl_)} {
+  pImpl_->ApplyTransform();
+  pImpl_->DuplicateMeshIDs();
+}
+
+EditSession::~EditSession() = default;
+
+/**
+ * Applies a Boolean to the body in place. Only the patch of the body near the
+ * tool is queried, assembled and triangulated. Its faces are flagged for
+ * removal and the new faces are appended to the body, which is not sorted or
+ * compacted. Its collider is carried over: the leaves are refit, and only the
+ * new faces are built into a subtree. A tool whose box contains the body's, or
+ * an INTERSECT, replaces the body with a full Boolean result instead.
+ */
+void EditSession::Boolean(const Manifold& tool, Manifold::OpType op) {
+  tool.pImpl_->ApplyTransform();
+  if (op == Manifold::OpType::SUBTRACT &&
+      !pImpl_->bBox_.DoesOverlap(tool.pImpl_->bBox_))
+    return;
+  Boolean3 boolean(*pImpl_, *tool.pImpl_, op);
+  const int firstNewFace = boolean.StitchPatch(op, *pImpl_);
+  if (firstNewFace >= 0) {
+    numFacesCoded_ += pImpl_->FinishEdit(firstNewFace);
+  } else {
+    *pImpl_ = boolean.Result(op);
+    numFacesCoded_ += pImpl_->NumTri();
+  }
+}
+
+EditSession& EditSession::operator+=(const Manifold& tool) {
+  Boolean(tool, Manifold::OpType::ADD);
+  return *this;
+}
+
+EditSession& EditSession::operator-=(const Manifold& tool) {
+  Boolean(tool, Manifold::OpType::SUBTRACT);
+  return *this;
+}
+
+EditSession& EditSession::operator^=(const Manifold& tool) {
+  Boolean(tool, Manifold::OpType::INTERSECT);
+  return *this;
+}
+
+/**
+ * Returns the number of faces whose Morton codes have been computed to build
+ * or update the body's collider so far. Repeated Manifold operators would code
+ * every face of each result.
+ */
+int EditSession::NumFacesCoded() const { return numFacesCoded_; }
+
+/**
+ * Removes the faces and verts cut away during the session and sorts the body
+ * as a Manifold operator would, then returns it. This ends the session,
+ * leaving it with an empty body.
+ */
+Manifold EditSession::Commit() {
+  pImpl_->Finish();
+  Manifold result;
+  result.pImpl_.swap(pImpl_);
+  pImpl_ = std::make_unique<Manifold::Impl>();
+  return result;
+}
+
+}  // namespace manifold
@@ -47,6 +47,32 @@ struct FaceAreaVolume {
   }
 };
 
+struct PolygonAreaVolume {
+  const Halfedge* halfedges;
+  const glm::vec3* vertPos;
+  const int* faceEdge;
+  const float precision;
+
+  __host__ __device__ thrust::pair<float, float> operator()(int face) {
+    const glm::vec3 anchor = vertPos[halfedges[faceEdge[face]].startVert];
+    float perimeter = 0;
+    glm::vec3 crossP(0.0f);
+    for (int i = faceEdge[face]; i < faceEdge[face + 1]; ++i) {
+      const glm::vec3 start = vertPos[halfedges[i].startVert] - anchor;
+      const glm::vec3 end = vertPos[halfedges[i].endVert] - anchor;
+      perimeter += glm::length(end - start);
+      crossP += glm::cross(start, end);
+    }
+
+    float area = glm::length(crossP);
+    float volume = glm::dot(crossP, anchor);
+
+    return area > perimeter * precision
+               ? thrust::make_pair(area / 2.0f, volume / 6.0f)
+               : thrust::make_pair(0.0f, 0.0f);
+  }
+};
+
 struct PosMin
     : public thrust::binary_function<glm::vec3, glm::vec3, glm::vec3> {
   __host__ __device__ glm::vec3 operator()(glm::vec3 a, glm::vec3 b) {
@@ -254,6 +280,22 @@ Properties Manifold::Impl::GetProperties() const {
   return {areaVolume.first, areaVolume.second};
 }
 
+/**
+ * As GetProperties, but for polygonal faces whose halfedges start at faceEdge,
+ * as assembled by a Boolean before triangulation. The halfedges of a face may
+ * be in any order, as each contributes independently to its area vector.
+ */
+Properties Manifold::Impl::GetPolygonProperties(
+    const VecDH<int>& faceEdge) const {
+  if (IsEmpty()) return {0, 0};
+  thrust::pair<float, float> areaVolume = thrust::transform_reduce(
+      countAt(0), countAt(faceEdge.size() - 1),
+      PolygonAreaVolume({halfedge_.cptrD(), vertPos_.cptrD(), faceEdge.cptrD(),
+                         precision_}),
+      thrust::make_pair(0.0f, 0.0f), SumPair());
+  return {areaVolume.first, areaVolume.second};
+}
+
 Curvature Manifold::Impl::GetCurvature() const {
   Curvature result;
   if (IsEmpty()) return result;
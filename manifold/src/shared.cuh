@@ -13,7 +13,10 @@
 // limitations under the License.
 
 #pragma once
+#include <thrust/count.h>
+#include <thrust/sequence.h>
 
+#include "utils.cuh"
 #include "vec_dh.cuh"
 
 namespace manifold {
@@ -138,6 +141,12 @@ struct Halfedge2Tmp {
   }
 };
 
+struct RemovedHalfedge {
+  __host__ __device__ bool operator()(const Halfedge& halfedge) {
+    return halfedge.pairedHalfedge < 0;
+  }
+};
+
 struct TmpInvalid {
   __host__ __device__ bool operator()(const TmpEdge& edge) {
     return edge.halfedgeIdx < 0;
@@ -150,7 +159,11 @@ VecDH<TmpEdge> inline CreateTmpEdges(const VecDH<Halfedge>& halfedge) {
                      edges.size(), Halfedge2Tmp());
   int numEdge = thrust::remove_if(edges.beginD(), edges.endD(), TmpInvalid()) -
                 edges.beginD();
-  ALWAYS_ASSERT(numEdge == halfedge.size() / 2, topologyErr, "Not oriented!");
+  // Halfedges flagged for removal are neither forward nor backward.
+  const int numRemoved =
+      thrust::count_if(halfedge.beginD(), halfedge.endD(), RemovedHalfedge());
+  ALWAYS_ASSERT(2 * numEdge + numRemoved == halfedge.size(), topologyErr,
+                "Not oriented!");
   edges.resize(numEdge);
   return edges;
 }
@@ -162,5 +175,65 @@ struct ReindexEdge {
     edge = edges[edge].halfedgeIdx;
   }
 };
+
+/**
+ * Finds the root of node in a union-find forest where every parent has a
+ * smaller index than its child, halving the path as it goes. Since roots only
+ * ever link to smaller roots, concurrent halving always writes an ancestor.
+ * Other threads link and halve the same entries meanwhile, so every access to
+ * parent is atomic.
+ */
+__host__ __device__ inline int FindRoot(int* parent, int node) {
+  int next = AtomicLoad(parent[node]);
+  while (next != node) {
+    const int grandparent = AtomicLoad(parent[next]);
+    if (grandparent != next) AtomicStore(parent[node], grandparent);
+    node = next;
+    next = AtomicLoad(parent[node]);
+  }
+  return node;
+}
+
+struct UnionEdge {
+  int* parent;
+
+  __host__ __device__ void operator()(thrust::pair<int, int> edge) {
+    if (edge.first < 0) return;
+    int a = edge.first;
+    int b = edge.second;
+    while (true) {
+      a = FindRoot(parent, a);
+      b = FindRoot(parent, b);
+      if (a == b) return;
+      if (a > b) thrust::swap(a, b);
+      // Fails only if b was linked by another thread, in which case retry.
+      if (AtomicCAS(parent[b], b, a) == b) return;
+    }
+  }
+};
+
+struct FlattenRoot {
+  int* parent;
+
+  __host__ __device__ void operator()(int node) {
+    AtomicStore(parent[node], FindRoot(parent, node));
+  }
+};
+
+/**
+ * Labels the connected components of a graph of numNode nodes with a
+ * lock-free parallel union-find over its edges, ignoring any edge whose first
+ * node is negative. Each node is labeled with the smallest node index in its
+ * component, so the result does not depend on thread scheduling.
+ */
+inline void LabelComponents(VecDH<int>& components,
+                            const VecDH<thrust::pair<int, int>>& edges,
+                            int numNode) {
+  components.resize(numNode);
+  thrust::sequence(components.beginD(), components.endD());
+  thrust::for_each(edges.beginD(), edges.endD(),
+                   UnionEdge({components.ptrD()}));
+  thrust::for_each_n(countAt(0), numNode, FlattenRoot({components.ptrD()}));
+}
 /** @} */
 }  // namespace manifold
\ No newline at end of file
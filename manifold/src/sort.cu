@@ -12,14 +12,26 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
 #include <thrust/sequence.h>
+#include <thrust/sort.h>
 
 #include "impl.cuh"
+#include "sort_permutation.cuh"
 
 namespace {
 using namespace manifold;
 
-constexpr uint32_t kNoCode = 0xFFFFFFFFu;
+// Above this many triangles, too many faces would share a 30-bit Morton code,
+// so 63-bit codes are used instead.
+constexpr int kMaxTri32BitMorton = 1 << 18;
+
+template <typename T>
+__host__ __device__ T NoCode() {
+  return ~T(0);
+}
 
 struct Extrema : public thrust::binary_function<Halfedge, Halfedge, Halfedge> {
   __host__ __device__ void MakeForward(Halfedge& a) {
@@ -53,45 +65,110 @@ __host__ __device__ uint32_t SpreadBits3(uint32_t v) {
   return v;
 }
 
-__host__ __device__ uint32_t MortonCode(glm::vec3 position, Box bBox) {
-  // Unreferenced vertices are marked NaN, and this will sort them to the end
-  // (the Morton code only uses the first 30 of 32 bits).
-  if (isnan(position.x)) return kNoCode;
+__host__ __device__ uint64_t SpreadBits3(uint64_t v) {
+  v = 0x001F00000000FFFFull & (v | v << 32);
+  v = 0x001F0000FF0000FFull & (v | v << 16);
+  v = 0x100F00F00F00F00Full & (v | v << 8);
+  v = 0x10C30C30C30C30C3ull & (v | v << 4);
+  v = 0x1249249249249249ull & (v | v << 2);
+  return v;
+}
 
+template <typename T>
+__host__ __device__ glm::uvec3 Quantize(glm::vec3 position, Box bBox) {
+  // bits per axis
+  constexpr int kBits = sizeof(T) == 8 ? 21 : 10;
+  constexpr float kScale = 1 << kBits;
   glm::vec3 xyz = (position - bBox.min) / (bBox.max - bBox.min);
-  xyz = glm::min(glm::vec3(1023.0f), glm::max(glm::vec3(0.0f), 1024.0f * xyz));
-  uint32_t x = SpreadBits3(static_cast<uint32_t>(xyz.x));
-  uint32_t y = SpreadBits3(static_cast<uint32_t>(xyz.y));
-  uint32_t z = SpreadBits3(static_cast<uint32_t>(xyz.z));
+  xyz = glm::min(glm::vec3(kScale - 1.0f),
+                 glm::max(glm::vec3(0.0f), kScale * xyz));
+  return glm::uvec3(xyz);
+}
+
+template <typename T>
+__host__ __device__ T MortonCode(glm::vec3 position, Box bBox) {
+  const glm::uvec3 xyz = Quantize<T>(position, bBox);
+  T x = SpreadBits3(static_cast<T>(xyz.x));
+  T y = SpreadBits3(static_cast<T>(xyz.y));
+  T z = SpreadBits3(static_cast<T>(xyz.z));
+  return x * 4 + y * 2 + z;
+}
+
+/**
+ * The index along a Hilbert curve, computed with Skilling's transpose
+ * algorithm (AIP Conf. Proc. 707, 381 (2004)): the quantized axes are rotated
+ * and reflected into the transposed Hilbert index, which is then interleaved
+ * exactly like a Morton code.
+ */
+template <typename T>
+__host__ __device__ T HilbertCode(glm::vec3 position, Box bBox) {
+  constexpr uint32_t kTop = 1u << (sizeof(T) == 8 ? 20 : 9);
+  glm::uvec3 xyz = Quantize<T>(position, bBox);
+  for (uint32_t q = kTop; q > 1; q >>= 1) {
+    const uint32_t p = q - 1;
+    for (const int i : {0, 1, 2}) {
+      if (xyz[i] & q) {
+        xyz[0] ^= p;
+      } else {
+        const uint32_t t = (xyz[0] ^ xyz[i]) & p;
+        xyz[0] ^= t;
+        xyz[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  xyz[1] ^= xyz[0];
+  xyz[2] ^= xyz[1];
+  uint32_t t = 0;
+  for (uint32_t q = kTop; q > 1; q >>= 1) {
+    if (xyz[2] & q) t ^= q - 1;
+  }
+  xyz ^= glm::uvec3(t);
+
+  T x = SpreadBits3(static_cast<T>(xyz.x));
+  T y = SpreadBits3(static_cast<T>(xyz.y));
+  T z = SpreadBits3(static_cast<T>(xyz.z));
   return x * 4 + y * 2 + z;
 }
 
+template <typename T>
+__host__ __device__ T SpatialCode(glm::vec3 position, Box bBox, bool hilbert) {
+  // Unreferenced vertices are marked NaN, and this will sort them to the end
+  // (the codes only use the first 30 of 32 or 63 of 64 bits).
+  if (isnan(position.x)) return NoCode<T>();
+  return hilbert ? HilbertCode<T>(position, bBox)
+                 : MortonCode<T>(position, bBox);
+}
+
+template <typename T>
 struct Morton {
   const Box bBox;
+  const bool hilbert;
 
   __host__ __device__ void operator()(
-      thrust::tuple<uint32_t&, const glm::vec3&> inout) {
+      thrust::tuple<T&, const glm::vec3&> inout) {
     glm::vec3 position = thrust::get<1>(inout);
-    thrust::get<0>(inout) = MortonCode(position, bBox);
+    thrust::get<0>(inout) = SpatialCode<T>(position, bBox, hilbert);
   }
 };
 
+template <typename T>
 struct FaceMortonBox {
   const Halfedge* halfedge;
   const glm::vec3* vertPos;
   const Box bBox;
+  const bool hilbert;
 
-  __host__ __device__ void operator()(
-      thrust::tuple<uint32_t&, Box&, int> inout) {
-    uint32_t& mortonCode = thrust::get<0>(inout);
+  __host__ __device__ void operator()(thrust::tuple<T&, Box&, int> inout) {
+    T& mortonCode = thrust::get<0>(inout);
     Box& faceBox = thrust::get<1>(inout);
     int face = thrust::get<2>(inout);
 
     // Removed tris are marked by all halfedges having pairedHalfedge = -1, and
     // this will sort them to the end (the Morton code only uses the first 30 of
-    // 32 bits).
+    // 32 or 63 of 64 bits).
     if (halfedge[3 * face].pairedHalfedge < 0) {
-      mortonCode = kNoCode;
+      mortonCode = NoCode<T>();
       return;
     }
 
@@ -104,7 +181,23 @@ struct FaceMortonBox {
     }
     center /= 3;
 
-    mortonCode = MortonCode(center, bBox);
+    mortonCode = SpatialCode<T>(center, bBox, hilbert);
+  }
+};
+
+struct FaceBox {
+  const Halfedge* halfedge;
+  const glm::vec3* vertPos;
+
+  __host__ __device__ void operator()(thrust::tuple<Box&, int> inout) {
+    Box& faceBox = thrust::get<0>(inout);
+    int face = thrust::get<1>(inout);
+
+    if (halfedge[3 * face].pairedHalfedge < 0) return;
+
+    for (const int i : {0, 1, 2}) {
+      faceBox.Union(vertPos[halfedge[3 * face + i].startVert]);
+    }
   }
 };
 
@@ -155,10 +248,230 @@ struct ReindexFace {
   }
 };
 
+/**
+ * Sorts the verts by Morton (or Hilbert) code, filling vertNew2Old with the
+ * resulting permutation, which is left empty if the verts were already in
+ * order. Returns the number of verts that are not flagged for removal.
+ */
+template <typename T>
+int SortVertsByMorton(VecDH<glm::vec3>& vertPos, VecDH<int>& vertNew2Old,
+                      const Box& bBox, bool hilbert) {
+  const int numVert = vertPos.size();
+  VecDH<T> vertMorton(numVert);
+  thrust::for_each_n(zip(vertMorton.beginD(), vertPos.cbeginD()), numVert,
+                     Morton<T>({bBox, hilbert}));
+
+  if (SortPermutation(vertMorton, vertNew2Old)) Permute(vertPos, vertNew2Old);
+
+  // Verts were flagged for removal with NaNs and assigned NoCode to sort them
+  // to the end, which allows them to be removed.
+  return thrust::find(vertMorton.beginD(), vertMorton.endD(), NoCode<T>()) -
+         vertMorton.beginD();
+}
+
+template <typename T>
+void SortFacesByMorton(Manifold::Impl& impl) {
+  VecDH<Box> faceBox;
+  VecDH<T> faceMorton;
+  impl.GetFaceBoxMorton(faceBox, faceMorton);
+  impl.SortFaces(faceBox, faceMorton);
+  if (impl.halfedge_.size() == 0) return;
+  impl.collider_ = Collider(faceBox, faceMorton);
+}
+
+struct NotRemoved {
+  const Halfedge* halfedge;
+
+  __host__ __device__ bool operator()(int face) {
+    return halfedge[3 * face].pairedHalfedge >= 0;
+  }
+};
+
+struct UnionBoxes : public thrust::binary_function<Box, Box, Box> {
+  __host__ __device__ Box operator()(const Box& a, const Box& b) {
+    return a.Union(b);
+  }
+};
+
+/**
+ * Refits the collider to the faces, in their boxes faceBox, and grafts on a
+ * subtree of the new faces from firstNewFace on, which are the only ones
+ * coded. If the collider has degraded, it is rebuilt over a sorted permutation
+ * of all of the faces instead, which still leaves the faces themselves in
+ * place. Returns the number of faces coded.
+ */
+template <typename T>
+int GraftNewFaces(Manifold::Impl& impl, VecDH<Box>& faceBox, int firstNewFace,
+                  bool hilbert) {
+  const int numTri = impl.NumTri();
+  VecDH<int> newFaces(numTri - firstNewFace);
+  const int numNew =
+      thrust::copy_if(countAt(firstNewFace), countAt(numTri), newFaces.beginD(),
+                      NotRemoved({impl.halfedge_.cptrD()})) -
+      newFaces.beginD();
+  newFaces.resize(numNew);
+
+  VecDH<T> newMorton(numNew);
+  VecDH<Box> newBox(numNew);
+  thrust::for_each_n(
+      zip(newMorton.beginD(), newBox.beginD(), newFaces.beginD()), numNew,
+      FaceMortonBox<T>({impl.halfedge_.cptrD(), impl.vertPos_.cptrD(),
+                        impl.bBox_, hilbert}));
+  VecDH<int> new2Old;
+  if (SortPermutation(newMorton, new2Old)) Permute(newFaces, new2Old);
+
+  if (impl.collider_.Graft(faceBox, newFaces, newMorton)) return numNew;
+
+  VecDH<T> faceMorton;
+  impl.GetFaceBoxMorton(faceBox, faceMorton);
+  VecDH<int> leafIndex;
+  if (!SortPermutation(faceMorton, leafIndex)) {
+    leafIndex.resize(numTri);
+    thrust::sequence(leafIndex.beginD(), leafIndex.endD());
+  }
+  // Faces flagged for removal were assigned NoCode, which sorts them to the
+  // end, so they get no leaves.
+  const int numLeaf =
+      thrust::find(faceMorton.beginD(), faceMorton.endD(), NoCode<T>()) -
+      faceMorton.beginD();
+  faceMorton.resize(numLeaf);
+  leafIndex.resize(numLeaf);
+  impl.collider_ =
+      numLeaf > 0 ? Collider(faceBox, faceMorton, leafIndex) : Collider();
+  return numNew + numLeaf;
+}
+
+/**
+ * The index along one axis of the weld grid cell containing x, clamped so
+ * that it and its neighbors fit in an int64_t.
+ */
+__host__ __device__ int64_t WeldCell(float x, float tolerance) {
+  constexpr double kMaxCell = 1ll << 62;
+  const double cell = glm::floor(static_cast<double>(x) / tolerance);
+  if (isnan(cell)) return 0;
+  return static_cast<int64_t>(glm::clamp(cell, -kMaxCell, kMaxCell));
+}
+
+/**
+ * Interleaves the low 21 bits of each cell index into a Morton code. Distant
+ * cells that wrap around to the same code only add candidates, since every
+ * candidate's distance is checked.
+ */
+__host__ __device__ uint64_t WeldKey(int64_t x, int64_t y, int64_t z) {
+  constexpr uint64_t kMask = (1ull << 21) - 1;
+  return SpreadBits3(static_cast<uint64_t>(x) & kMask) * 4 +
+         SpreadBits3(static_cast<uint64_t>(y) & kMask) * 2 +
+         SpreadBits3(static_cast<uint64_t>(z) & kMask);
+}
+
+struct VertWeldKey {
+  const float tolerance;
+
+  __host__ __device__ uint64_t operator()(glm::vec3 pos) {
+    return WeldKey(WeldCell(pos.x, tolerance), WeldCell(pos.y, tolerance),
+                   WeldCell(pos.z, tolerance));
+  }
+};
+
+struct WeldNeighbors {
+  int* parent;
+  const glm::vec3* vertPos;
+  const uint64_t* sortedKey;
+  const int* sortedVert;
+  const int numVert;
+  const float tolerance;
+
+  __host__ __device__ void operator()(int vert) {
+    const glm::vec3 pos = vertPos[vert];
+    int64_t cell[3];
+    for (int i : {0, 1, 2}) cell[i] = WeldCell(pos[i], tolerance);
+
+    // With cells as wide as the tolerance, every vert in reach lies in one of
+    // the 27 cells around this one.
+    for (int dx : {-1, 0, 1}) {
+      for (int dy : {-1, 0, 1}) {
+        for (int dz : {-1, 0, 1}) {
+          const uint64_t key =
+              WeldKey(cell[0] + dx, cell[1] + dy, cell[2] + dz);
+          int begin = 0;
+          int end = numVert;
+          while (begin < end) {
+            const int mid = (begin + end) / 2;
+            if (sortedKey[mid] < key)
+              begin = mid + 1;
+            else
+              end = mid;
+          }
+          for (int i = begin; i < numVert && sortedKey[i] == key; ++i) {
+            const int other = sortedVert[i];
+            if (other < vert && glm::distance(pos, vertPos[other]) <= tolerance)
+              UnionEdge({parent})(thrust::make_pair(other, vert));
+          }
+        }
+      }
+    }
+  }
+};
+
+struct IsRoot {
+  __host__ __device__ int operator()(int vert, int root) {
+    return vert == root;
+  }
+};
+
+struct WeldTri {
+  const int* parent;
+  const int* rootIdx;
+
+  __host__ __device__ void operator()(glm::ivec3& tri) {
+    for (int i : {0, 1, 2}) tri[i] = rootIdx[parent[tri[i]]];
+  }
+};
+
+struct DegenerateTri {
+  __host__ __device__ bool operator()(const glm::ivec3& tri) {
+    return tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0];
+  }
+};
+
+struct DegenerateHalfedge {
+  const glm::ivec3* triVerts;
+
+  __host__ __device__ bool operator()(int halfedge) {
+    return DegenerateTri()(triVerts[halfedge / 3]);
+  }
+};
 }  // namespace
 
 namespace manifold {
 
+/**
+ * Finishes a Boolean result in place of Finish when it is about to be modified
+ * again, as the body of an EditSession. Boolean3::StitchPatch has appended the
+ * faces from firstNewFace on and flagged those it replaced for removal, while
+ * the collider is still that of the body before. Nothing is sorted, and the
+ * faces and verts flagged for removal are left for Finish to drop. The
+ * bounding box only grows to fit the new faces, the collider is updated with
+ * Collider::Graft, so only the new faces are coded, and only the normals of
+ * their verts are recalculated. Returns the number of faces coded.
+ */
+int Manifold::Impl::FinishEdit(int firstNewFace) {
+  VecDH<Box> faceBox;
+  GetFaceBox(faceBox);
+  bBox_ = thrust::reduce(faceBox.beginD() + firstNewFace, faceBox.endD(),
+                         bBox_, UnionBoxes());
+  SetPrecision(precision_);
+
+  const bool hilbert = ordering_ == Ordering::HILBERT;
+  const int numCoded =
+      NumTri() > kMaxTri32BitMorton
+          ? GraftNewFaces<uint64_t>(*this, faceBox, firstNewFace, hilbert)
+          : GraftNewFaces<uint32_t>(*this, faceBox, firstNewFace, hilbert);
+
+  CalculateNormals(firstNewFace);
+  return numCoded;
+}
+
 /**
  * Once halfedge_ has been filled in, this function can be called to create the
  * rest of the internal data structures. This function also removes the verts
@@ -177,10 +490,7 @@ void Manifold::Impl::Finish() {
   }
 
   SortVerts();
-  VecDH<Box> faceBox;
-  VecDH<uint32_t> faceMorton;
-  GetFaceBoxMorton(faceBox, faceMorton);
-  SortFaces(faceBox, faceMorton);
+  SortFacesAndBuildCollider();
   if (halfedge_.size() == 0) return;
 
   ALWAYS_ASSERT(halfedge_.size() % 6 == 0, topologyErr,
@@ -202,29 +512,22 @@ void Manifold::Impl::Finish() {
                 "Halfedge index exceeds number of halfedges!");
 
   CalculateNormals();
-  collider_ = Collider(faceBox, faceMorton);
 }
 
 /**
- * Sorts the vertices according to their Morton code.
+ * Sorts the vertices according to their Morton code, or Hilbert code if that
+ * ordering has been selected.
  */
 void Manifold::Impl::SortVerts() {
-  VecDH<uint32_t> vertMorton(NumVert());
-  thrust::for_each_n(zip(vertMorton.beginD(), vertPos_.cbeginD()), NumVert(),
-                     Morton({bBox_}));
-
-  VecDH<int> vertNew2Old(NumVert());
-  thrust::sequence(vertNew2Old.beginD(), vertNew2Old.endD());
-  thrust::sort_by_key(vertMorton.beginD(), vertMorton.endD(),
-                      zip(vertPos_.beginD(), vertNew2Old.beginD()));
-
-  ReindexVerts(vertNew2Old, NumVert());
-
-  // Verts were flagged for removal with NaNs and assigned kNoCode to sort them
-  // to the end, which allows them to be removed.
+  const int numVert = NumVert();
+  const bool hilbert = ordering_ == Ordering::HILBERT;
+  VecDH<int> vertNew2Old;
   const int newNumVert =
-      thrust::find(vertMorton.beginD(), vertMorton.endD(), kNoCode) -
-      vertMorton.beginD();
+      NumTri() > kMaxTri32BitMorton
+          ? SortVertsByMorton<uint64_t>(vertPos_, vertNew2Old, bBox_, hilbert)
+          : SortVertsByMorton<uint32_t>(vertPos_, vertNew2Old, bBox_, hilbert);
+
+  if (vertNew2Old.size() > 0) ReindexVerts(vertNew2Old, numVert);
   vertPos_.resize(newNumVert);
 }
 
@@ -242,37 +545,57 @@ void Manifold::Impl::ReindexVerts(const VecDH<int>& vertNew2Old,
                    Reindex({vertOld2New.cptrD()}));
 }
 
+/**
+ * Fills faceBox with the bounding boxes of the faces, for refitting the
+ * collider when no Morton codes are needed. Removed faces get empty boxes.
+ */
+void Manifold::Impl::GetFaceBox(VecDH<Box>& faceBox) const {
+  faceBox.resize(NumTri());
+  thrust::for_each_n(zip(faceBox.beginD(), countAt(0)), NumTri(),
+                     FaceBox({halfedge_.cptrD(), vertPos_.cptrD()}));
+}
+
 /**
  * Fills the faceBox and faceMorton input with the bounding boxes and Morton
  * codes of the faces, respectively. The Morton code is based on the center of
- * the bounding box.
+ * the bounding box. If Hilbert ordering has been selected, the codes are
+ * instead Hilbert indices, which the collider can use just the same, since
+ * they likewise subdivide space into nested octants.
  */
+template <typename T>
 void Manifold::Impl::GetFaceBoxMorton(VecDH<Box>& faceBox,
-                                      VecDH<uint32_t>& faceMorton) const {
+                                      VecDH<T>& faceMorton) const {
   faceBox.resize(NumTri());
   faceMorton.resize(NumTri());
   thrust::for_each_n(
       zip(faceMorton.beginD(), faceBox.beginD(), countAt(0)), NumTri(),
-      FaceMortonBox({halfedge_.cptrD(), vertPos_.cptrD(), bBox_}));
+      FaceMortonBox<T>({halfedge_.cptrD(), vertPos_.cptrD(), bBox_,
+                        ordering_ == Ordering::HILBERT}));
 }
 
 /**
  * Sorts the faces of this manifold according to their input Morton code. The
  * bounding box and Morton code arrays are also sorted accordingly.
  */
-void Manifold::Impl::SortFaces(VecDH<Box>& faceBox,
-                               VecDH<uint32_t>& faceMorton) {
-  VecDH<int> faceNew2Old(NumTri());
-  thrust::sequence(faceNew2Old.beginD(), faceNew2Old.endD());
-
-  thrust::sort_by_key(faceMorton.beginD(), faceMorton.endD(),
-                      zip(faceBox.beginD(), faceNew2Old.beginD()));
+template <typename T>
+void Manifold::Impl::SortFaces(VecDH<Box>& faceBox, VecDH<T>& faceMorton) {
+  VecDH<int> faceNew2Old;
+  const bool permuted = SortPermutation(faceMorton, faceNew2Old);
 
-  // Tris were flagged for removal with pairedHalfedge = -1 and assigned kNoCode
+  // Tris were flagged for removal with pairedHalfedge = -1 and assigned NoCode
   // to sort them to the end, which allows them to be removed.
   const int newNumTri =
-      thrust::find(faceMorton.beginD(), faceMorton.endD(), kNoCode) -
+      thrust::find(faceMorton.beginD(), faceMorton.endD(), NoCode<T>()) -
       faceMorton.beginD();
+
+  if (permuted) {
+    Permute(faceBox, faceNew2Old);
+  } else {
+    // Already in order and nothing to remove, so there is nothing to do.
+    if (newNumTri == NumTri()) return;
+    faceNew2Old.resize(NumTri());
+    thrust::sequence(faceNew2Old.beginD(), faceNew2Old.endD());
+  }
   faceBox.resize(newNumTri);
   faceMorton.resize(newNumTri);
   faceNew2Old.resize(newNumTri);
@@ -280,6 +603,18 @@ void Manifold::Impl::SortFaces(VecDH<Box>& faceBox,
   GatherFaces(faceNew2Old);
 }
 
+/**
+ * Sorts the faces and builds a new collider for them. Meshes with many
+ * triangles use 63-bit Morton codes, which keep faces from sharing codes, as
+ * that degrades both the memory locality and the balance of the collider.
+ */
+void Manifold::Impl::SortFacesAndBuildCollider() {
+  if (NumTri() > kMaxTri32BitMorton)
+    SortFacesByMorton<uint64_t>(*this);
+  else
+    SortFacesByMorton<uint32_t>(*this);
+}
+
 /**
  * Creates the halfedge_ vector for this manifold by copying a set of faces from
  * another manifold, given by oldHalfedge. Input faceNew2Old defines the old
@@ -335,4 +670,85 @@ void Manifold::Impl::GatherFaces(const Impl& old,
                    old.halfedge_.cptrD(), old.halfedgeTangent_.cptrD(),
                    faceNew2Old.cptrD(), faceOld2New.cptrD()}));
 }
-}  // namespace manifold
\ No newline at end of file
+
+template void Manifold::Impl::GetFaceBoxMorton<uint32_t>(
+    VecDH<Box>&, VecDH<uint32_t>&) const;
+
+/**
+ * Welds together the verts of mesh that are within tolerance of each other,
+ * such as the duplicated corners of a triangle soup, so that it can be used to
+ * construct a Manifold. Merging is transitive, so a chain of close verts will
+ * become one even if its ends are farther apart than tolerance.
+ *
+ * The verts are bucketed into a grid of cells as wide as tolerance and sorted
+ * by the Morton codes of their cells, so each vert only checks the verts of
+ * its neighboring cells. Close pairs are merged with a parallel union-find.
+ * Each group of verts keeps the position of its first vert, the verts are
+ * compacted in their original order, and triangles that become degenerate are
+ * removed.
+ *
+ * @param mesh The mesh to modify in place. vertNormal and halfedgeTangent are
+ * kept in step, if present.
+ * @param tolerance The distance within which verts are merged.
+ */
+void MergeVerts(Mesh& mesh, float tolerance) {
+  ALWAYS_ASSERT(tolerance > 0, userErr, "tolerance must be positive.");
+  const int numVert = mesh.vertPos.size();
+  const int numTri = mesh.triVerts.size();
+  if (numVert == 0) return;
+
+  VecDH<glm::vec3> vertPos(mesh.vertPos);
+  VecDH<uint64_t> sortedKey(numVert);
+  thrust::transform(vertPos.beginD(), vertPos.endD(), sortedKey.beginD(),
+                    VertWeldKey({tolerance}));
+  VecDH<int> sortedVert(numVert);
+  thrust::sequence(sortedVert.beginD(), sortedVert.endD());
+  thrust::sort_by_key(sortedKey.beginD(), sortedKey.endD(),
+                      sortedVert.beginD());
+
+  VecDH<int> parent(numVert);
+  thrust::sequence(parent.beginD(), parent.endD());
+  thrust::for_each_n(
+      countAt(0), numVert,
+      WeldNeighbors({parent.ptrD(), vertPos.cptrD(), sortedKey.cptrD(),
+                     sortedVert.cptrD(), numVert, tolerance}));
+  thrust::for_each_n(countAt(0), numVert, FlattenRoot({parent.ptrD()}));
+
+  VecDH<int> isRoot(numVert);
+  thrust::transform(countAt(0), countAt(numVert), parent.beginD(),
+                    isRoot.beginD(), IsRoot());
+  VecDH<int> rootIdx(numVert);
+  thrust::exclusive_scan(isRoot.beginD(), isRoot.endD(), rootIdx.beginD());
+  const int numRoot = rootIdx.H().back() + isRoot.H().back();
+
+  VecDH<glm::vec3> newPos(numRoot);
+  thrust::copy_if(vertPos.beginD(), vertPos.endD(), isRoot.beginD(),
+                  newPos.beginD(), thrust::identity<int>());
+  mesh.vertPos.assign(newPos.begin(), newPos.end());
+  if (mesh.vertNormal.size() == numVert) {
+    VecDH<glm::vec3> normal(mesh.vertNormal);
+    VecDH<glm::vec3> newNormal(numRoot);
+    thrust::copy_if(normal.beginD(), normal.endD(), isRoot.beginD(),
+                    newNormal.beginD(), thrust::identity<int>());
+    mesh.vertNormal.assign(newNormal.begin(), newNormal.end());
+  }
+
+  VecDH<glm::ivec3> triVerts(mesh.triVerts);
+  thrust::for_each(triVerts.beginD(), triVerts.endD(),
+                   WeldTri({parent.cptrD(), rootIdx.cptrD()}));
+  if (mesh.halfedgeTangent.size() == 3 * numTri) {
+    VecDH<glm::vec4> tangent(mesh.halfedgeTangent);
+    const int numHalfedge =
+        thrust::remove_if(tangent.beginD(), tangent.endD(), countAt(0),
+                          DegenerateHalfedge({triVerts.cptrD()})) -
+        tangent.beginD();
+    tangent.resize(numHalfedge);
+    mesh.halfedgeTangent.assign(tangent.begin(), tangent.end());
+  }
+  const int numNewTri = thrust::remove_if(triVerts.beginD(), triVerts.endD(),
+                                          DegenerateTri()) -
+                        triVerts.beginD();
+  triVerts.resize(numNewTri);
+  mesh.triVerts.assign(triVerts.begin(), triVerts.end());
+}
+}  // namespace manifold
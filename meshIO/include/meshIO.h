@@ -35,22 +35,55 @@ struct ExportOptions {
 /**
  * @brief Read mesh file.
  *
- * @param filename Handles any files the Assimp library can import.
+ * @param filename Handles any files the Assimp library can import. Binary STL,
+ * and PLY and OBJ files of triangles, are read natively, which is much faster
+ * for large files.
  * @return Mesh The mesh should be checked for manifoldness.
  */
 Mesh ImportMesh(const std::string& filename);
 
+/**
+ * One placement of a mesh in an imported scene.
+ */
+struct MeshInstance {
+  int meshIdx;
+  glm::mat4x3 transform;
+};
+
+/**
+ * The parts of an imported scene: each unique mesh once, and every place it is
+ * used.
+ */
+struct MeshScene {
+  std::vector<Mesh> meshes;
+  std::vector<MeshInstance> instances;
+};
+
+/**
+ * @brief Read each mesh of a file separately.
+ *
+ * @param filename Handles the same files as ImportMesh, but rather than baking
+ * the scene into a single mesh, keeps its meshes separate. A mesh used by
+ * several nodes is returned once, with an instance for each node. Manifolds
+ * may be built from the meshes concurrently, then copied and transformed for
+ * each instance.
+ * @return MeshScene Each mesh should be checked for manifoldness.
+ */
+MeshScene ImportMeshes(const std::string& filename);
+
 /**
  *
  * @brief Write mesh file.
  *
  * @param filename The file extension must be one that Assimp supports for
- * export. GLB & 3MF are recommended.
- * @param mesh The mesh to export, likely from Manifold.GetMesh().
- * @param options The options currently only affect an exported GLB's material.
- * Pass {} for defaults.
+ * export. GLB & 3MF are recommended. STL, GLB and 3MF are written natively,
+ * streaming straight from the mesh's arrays.
+ * @param mesh The mesh to export. This may be a Mesh, or a view from
+ * Manifold.GetMeshView() to export a result without first copying it.
+ * @param options The options currently only affect an exported GLB's material,
+ * and a 3MF's color. Pass {} for defaults.
  */
-void ExportMesh(const std::string& filename, const Mesh& mesh,
+void ExportMesh(const std::string& filename, const MeshView& mesh,
                 const ExportOptions& options);
 /** @} */
 }  // namespace manifold
\ No newline at end of file
@@ -0,0 +1,266 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "native_io.h"
+
+namespace {
+using namespace manifold;
+
+constexpr uint32_t kLocalHeader = 0x04034b50;
+constexpr uint32_t kCentralHeader = 0x02014b50;
+constexpr uint32_t kEndOfCentralDirectory = 0x06054b50;
+constexpr uint16_t kZipVersion = 20;
+constexpr uint16_t kDosDate = (0 << 9) | (1 << 5) | 1;  // 1980-01-01
+
+uint32_t Crc32(uint32_t crc, const char* data, size_t size) {
+  static const std::vector<uint32_t> table = [] {
+    std::vector<uint32_t> table(256);
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      table[i] = c;
+    }
+    return table;
+  }();
+  crc = ~crc;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+/**
+ * Writes a zip archive of uncompressed entries, as used by 3MF packages. Each
+ * entry is streamed through a buffer, and its local header is patched with the
+ * CRC and size once the entry is finished, so no entry is held in memory.
+ */
+class ZipWriter {
+ public:
+  explicit ZipWriter(const std::string& filename)
+      : filename_(filename), file_(filename, std::ios::binary) {
+    ALWAYS_ASSERT(file_.is_open(), userErr,
+                  "Could not open " + filename + " for writing.");
+  }
+
+  void StartEntry(const std::string& name) {
+    entries_.push_back({name, Offset(), 0, 0});
+    WriteHeader(kLocalHeader, entries_.back());
+  }
+
+  void Write(const char* data, size_t size) {
+    buffer_.append(data, size);
+    if (buffer_.size() > kBufferSize) Flush();
+  }
+
+  void Write(const std::string& text) { Write(text.data(), text.size()); }
+
+  void EndEntry() {
+    Flush();
+    const size_t end = Offset();
+    Entry& entry = entries_.back();
+    file_.seekp(entry.offset);
+    WriteHeader(kLocalHeader, entry);
+    file_.seekp(end);
+  }
+
+  void Close() {
+    const size_t start = Offset();
+    for (const Entry& entry : entries_) WriteHeader(kCentralHeader, entry);
+    const size_t end = Offset();
+    ALWAYS_ASSERT(end <= UINT32_MAX, userErr,
+                  "File is too large for 3MF: " + filename_);
+    Write32(kEndOfCentralDirectory);
+    Write16(0);  // this disk
+    Write16(0);  // disk with the central directory
+    Write16(entries_.size());
+    Write16(entries_.size());
+    Write32(end - start);
+    Write32(start);
+    Write16(0);  // comment length
+    ALWAYS_ASSERT(file_.good(), userErr, "Failed to write " + filename_);
+  }
+
+ private:
+  struct Entry {
+    std::string name;
+    size_t offset;
+    uint32_t crc;
+    size_t size;
+  };
+
+  static constexpr size_t kBufferSize = 1 << 20;
+  const std::string filename_;
+  std::ofstream file_;
+  std::vector<Entry> entries_;
+  std::string buffer_;
+
+  size_t Offset() { return file_.tellp(); }
+
+  void Flush() {
+    Entry& entry = entries_.back();
+    entry.crc = Crc32(entry.crc, buffer_.data(), buffer_.size());
+    entry.size += buffer_.size();
+    ALWAYS_ASSERT(entry.size <= UINT32_MAX, userErr,
+                  "Mesh is too large for 3MF: " + filename_);
+    file_.write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+  }
+
+  void Write16(uint16_t value) {
+    file_.write(reinterpret_cast<const char*>(&value), sizeof(uint16_t));
+  }
+
+  void Write32(uint32_t value) {
+    file_.write(reinterpret_cast<const char*>(&value), sizeof(uint32_t));
+  }
+
+  void WriteHeader(uint32_t signature, const Entry& entry) {
+    const bool central = signature == kCentralHeader;
+    Write32(signature);
+    if (central) Write16(kZipVersion);  // version made by
+    Write16(kZipVersion);               // version needed to extract
+    Write16(0);                         // flags
+    Write16(0);                         // stored, no compression
+    Write16(0);                         // time
+    Write16(kDosDate);
+    Write32(entry.crc);
+    Write32(entry.size);  // compressed
+    Write32(entry.size);  // uncompressed
+    Write16(entry.name.size());
+    Write16(0);  // extra field length
+    if (central) {
+      Write16(0);  // comment length
+      Write16(0);  // disk number
+      Write16(0);  // internal attributes
+      Write32(0);  // external attributes
+      Write32(entry.offset);
+    }
+    file_.write(entry.name.data(), entry.name.size());
+  }
+};
+
+/**
+ * Prints color into line as 8-bit RGBA, using format, which must contain the
+ * four %02X conversions.
+ */
+template <size_t N>
+int Hex(char (&line)[N], const char* format, const glm::vec4& color) {
+  const glm::vec4 c =
+      255.0f * glm::clamp(color, glm::vec4(0.0f), glm::vec4(1.0f)) + 0.5f;
+  return std::snprintf(line, N, format, static_cast<int>(c.r),
+                       static_cast<int>(c.g), static_cast<int>(c.b),
+                       static_cast<int>(c.a));
+}
+}  // namespace
+
+namespace manifold {
+
+/**
+ * Writes mesh as a 3MF package, streaming the model XML straight from the
+ * mesh's arrays into an uncompressed zip entry. Vertex colors, if present, are
+ * written as a color group using the materials extension; otherwise the
+ * material color is used for the whole object.
+ */
+void Export3MF(const std::string& filename, const MeshView& mesh,
+               const ExportOptions& options) {
+  const std::vector<glm::vec4>& vertColor = options.mat.vertColor;
+  const bool hasColors = !vertColor.empty();
+  ALWAYS_ASSERT(!hasColors || vertColor.size() == mesh.vertPos.size(), userErr,
+                "If present, vertColor must be the same length as vertPos.");
+
+  // The XML requires a '.' decimal point, so numbers are printed in the "C"
+  // locale.
+  const ScopedCLocale cLocale;
+  ZipWriter zip(filename);
+  zip.StartEntry("[Content_Types].xml");
+  zip.Write(
+      R"(<?xml version="1.0" encoding="UTF-8"?>)"
+      "\n"
+      R"(<Types xmlns="http://schemas.openxmlformats.org/package/2006/content-types">)"
+      R"(<Default Extension="rels" ContentType="application/vnd.openxmlformats-package.relationships+xml"/>)"
+      R"(<Default Extension="model" ContentType="application/vnd.ms-package.3dmanufacturing-3dmodel+xml"/>)"
+      "</Types>\n");
+  zip.EndEntry();
+
+  zip.StartEntry("_rels/.rels");
+  zip.Write(
+      R"(<?xml version="1.0" encoding="UTF-8"?>)"
+      "\n"
+      R"(<Relationships xmlns="http://schemas.openxmlformats.org/package/2006/relationships">)"
+      R"(<Relationship Target="/3D/3dmodel.model" Id="rel0" Type="http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel"/>)"
+      "</Relationships>\n");
+  zip.EndEntry();
+
+  zip.StartEntry("3D/3dmodel.model");
+  zip.Write(
+      R"(<?xml version="1.0" encoding="UTF-8"?>)"
+      "\n"
+      R"(<model unit="millimeter" xml:lang="en-US" xmlns="http://schemas.microsoft.com/3dmanufacturing/core/2015/02")"
+      R"( xmlns:m="http://schemas.microsoft.com/3dmanufacturing/material/2015/02">)"
+      "\n<resources>\n");
+  char line[128];
+  if (hasColors) {
+    zip.Write("<m:colorgroup id=\"2\">\n");
+    for (const glm::vec4& color : vertColor) {
+      const int length = Hex(line, "<m:color color=\"#%02X%02X%02X%02X\"/>\n",
+                             color);
+      zip.Write(line, length);
+    }
+    zip.Write("</m:colorgroup>\n");
+  } else {
+    const int length = Hex(line,
+                           "<basematerials id=\"2\"><base name=\"Material\" "
+                           "displaycolor=\"#%02X%02X%02X%02X\"/>"
+                           "</basematerials>\n",
+                           options.mat.color);
+    zip.Write(line, length);
+  }
+  zip.Write(
+      "<object id=\"1\" type=\"model\" pid=\"2\" pindex=\"0\">\n<mesh>\n"
+      "<vertices>\n");
+  for (const glm::vec3& v : mesh.vertPos) {
+    const int length = std::snprintf(
+        line, sizeof(line), "<vertex x=\"%.9g\" y=\"%.9g\" z=\"%.9g\"/>\n",
+        v.x, v.y, v.z);
+    zip.Write(line, length);
+  }
+  zip.Write("</vertices>\n<triangles>\n");
+  for (size_t i = 0; i < mesh.triVerts.size(); ++i) {
+    const glm::ivec3 tri = mesh.triVerts[i];
+    int length;
+    if (hasColors) {
+      length = std::snprintf(
+          line, sizeof(line),
+          "<triangle v1=\"%d\" v2=\"%d\" v3=\"%d\" p1=\"%d\" p2=\"%d\" "
+          "p3=\"%d\"/>\n",
+          tri[0], tri[1], tri[2], tri[0], tri[1], tri[2]);
+    } else {
+      length = std::snprintf(line, sizeof(line),
+                             "<triangle v1=\"%d\" v2=\"%d\" v3=\"%d\"/>\n",
+                             tri[0], tri[1], tri[2]);
+    }
+    zip.Write(line, length);
+  }
+  zip.Write(
+      "</triangles>\n</mesh>\n</object>\n</resources>\n"
+      "<build><item objectid=\"1\"/></build>\n</model>\n");
+  zip.EndEntry();
+  zip.Close();
+}
+
+}  // namespace manifold
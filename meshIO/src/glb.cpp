@@ -0,0 +1,202 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+#include "native_io.h"
+
+namespace {
+using namespace manifold;
+
+constexpr uint32_t kGlbMagic = 0x46546C67;  // "glTF"
+constexpr uint32_t kJsonChunk = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kBinChunk = 0x004E4942;   // "BIN"
+constexpr int kFloat = 5126;
+constexpr int kUnsignedInt = 5125;
+constexpr int kArrayBuffer = 34962;
+constexpr int kElementArrayBuffer = 34963;
+
+// glTF is Y-up, while Manifold is Z-up.
+inline glm::vec3 YUp(const glm::vec3& v) { return glm::vec3(v.y, v.z, v.x); }
+
+void Write32(std::ostream& stream, uint32_t value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(uint32_t));
+}
+
+/**
+ * Writes vectors in blocks after swizzling them to Y-up.
+ */
+void WriteYUp(std::ostream& stream, VecView<glm::vec3> vecs) {
+  std::vector<glm::vec3> block(std::min<size_t>(vecs.size(), kIOChunk));
+  for (size_t start = 0; start < vecs.size(); start += kIOChunk) {
+    const size_t end = std::min(vecs.size(), start + kIOChunk);
+    for (size_t i = start; i < end; ++i) block[i - start] = YUp(vecs[i]);
+    stream.write(reinterpret_cast<const char*>(block.data()),
+                 (end - start) * sizeof(glm::vec3));
+  }
+}
+
+struct BufferView {
+  size_t offset;
+  size_t length;
+  int target;
+};
+
+struct Accessor {
+  int count;
+  int componentType;
+  const char* type;
+  const char* attribute;  // nullptr for the indices
+};
+
+std::string GlbJson(const std::vector<BufferView>& views,
+                    const std::vector<Accessor>& accessors, glm::vec3 min,
+                    glm::vec3 max, size_t binLength, const Material& mat) {
+  std::ostringstream json;
+  json.imbue(std::locale::classic());
+  json.precision(std::numeric_limits<float>::max_digits10);
+  json << R"({"asset":{"version":"2.0","generator":"Manifold"},)"
+       << R"("scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+       << R"("meshes":[{"primitives":[{"attributes":{)";
+  int indices = 0;
+  for (int i = 0; i < accessors.size(); ++i) {
+    if (accessors[i].attribute == nullptr) {
+      indices = i;
+    } else {
+      json << (i > 0 ? "," : "") << '"' << accessors[i].attribute
+           << R"(":)" << i;
+    }
+  }
+  json << R"(},"indices":)" << indices << R"(,"material":0,"mode":4}]}],)";
+
+  json << R"("materials":[{"pbrMetallicRoughness":{"baseColorFactor":[)"
+       << mat.color.r << ',' << mat.color.g << ',' << mat.color.b << ','
+       << mat.color.a << R"(],"metallicFactor":)" << mat.metalness
+       << R"(,"roughnessFactor":)" << mat.roughness << "}}],";
+
+  json << R"("buffers":[{"byteLength":)" << binLength << "}],";
+  json << R"("bufferViews":[)";
+  for (int i = 0; i < views.size(); ++i) {
+    json << (i > 0 ? "," : "") << R"({"buffer":0,"byteOffset":)"
+         << views[i].offset << R"(,"byteLength":)" << views[i].length
+         << R"(,"target":)" << views[i].target << "}";
+  }
+  json << R"(],"accessors":[)";
+  for (int i = 0; i < accessors.size(); ++i) {
+    json << (i > 0 ? "," : "") << R"({"bufferView":)" << i
+         << R"(,"componentType":)" << accessors[i].componentType
+         << R"(,"count":)" << accessors[i].count << R"(,"type":")"
+         << accessors[i].type << '"';
+    if (i == 0) {
+      json << R"(,"min":[)" << min.x << ',' << min.y << ',' << min.z
+           << R"(],"max":[)" << max.x << ',' << max.y << ',' << max.z << "]";
+    }
+    json << "}";
+  }
+  json << "]}";
+  return json.str();
+}
+}  // namespace
+
+namespace manifold {
+
+/**
+ * Writes mesh as binary glTF. The JSON and the position bounds are produced
+ * first, after which the vertex attributes and indices are streamed to the
+ * file straight from the mesh's arrays, swizzled to Y-up in blocks where
+ * needed.
+ */
+void ExportGLB(const std::string& filename, const MeshView& mesh,
+               const ExportOptions& options) {
+  const int numVert = mesh.vertPos.size();
+  const int numTri = mesh.triVerts.size();
+  const bool hasNormals = !options.faceted;
+  const bool hasColors = !options.mat.vertColor.empty();
+  ALWAYS_ASSERT(
+      !hasNormals || mesh.vertNormal.size() == numVert, userErr,
+      "vertNormal must be the same length as vertPos when faceted is false.");
+  ALWAYS_ASSERT(!hasColors || options.mat.vertColor.size() == numVert, userErr,
+                "If present, vertColor must be the same length as vertPos.");
+
+  glm::vec3 min(std::numeric_limits<float>::infinity());
+  glm::vec3 max(-std::numeric_limits<float>::infinity());
+  for (const glm::vec3& v : mesh.vertPos) {
+    min = glm::min(min, YUp(v));
+    max = glm::max(max, YUp(v));
+  }
+
+  std::vector<BufferView> views;
+  std::vector<Accessor> accessors;
+  size_t binLength = 0;
+  auto addView = [&](int count, size_t elementSize, int componentType,
+                     const char* type, const char* attribute) {
+    views.push_back({binLength, count * elementSize,
+                     attribute ? kArrayBuffer : kElementArrayBuffer});
+    accessors.push_back({count, componentType, type, attribute});
+    binLength += count * elementSize;
+  };
+  addView(numVert, sizeof(glm::vec3), kFloat, "VEC3", "POSITION");
+  if (hasNormals) addView(numVert, sizeof(glm::vec3), kFloat, "VEC3", "NORMAL");
+  if (hasColors) addView(numVert, sizeof(glm::vec4), kFloat, "VEC4", "COLOR_0");
+  addView(3 * numTri, sizeof(uint32_t), kUnsignedInt, "SCALAR", nullptr);
+
+  std::string json =
+      GlbJson(views, accessors, min, max, binLength, options.mat);
+  // Chunks are 4-byte aligned; the JSON is padded with spaces. The binary
+  // chunk needs no padding, as all of its elements are 4 bytes.
+  json.resize((json.size() + 3) / 4 * 4, ' ');
+  const size_t totalLength = 12 + 8 + json.size() + 8 + binLength;
+  ALWAYS_ASSERT(totalLength <= UINT32_MAX, userErr,
+                "Mesh is too large for GLB: " + filename);
+
+  std::ofstream file(filename, std::ios::binary);
+  ALWAYS_ASSERT(file.is_open(), userErr,
+                "Could not open " + filename + " for writing.");
+  Write32(file, kGlbMagic);
+  Write32(file, 2);
+  Write32(file, totalLength);
+  Write32(file, json.size());
+  Write32(file, kJsonChunk);
+  file.write(json.data(), json.size());
+  Write32(file, binLength);
+  Write32(file, kBinChunk);
+
+  WriteYUp(file, mesh.vertPos);
+  if (hasNormals) WriteYUp(file, mesh.vertNormal);
+  if (hasColors)
+    file.write(reinterpret_cast<const char*>(options.mat.vertColor.data()),
+               numVert * sizeof(glm::vec4));
+  // Indices are never negative, so they have the same bytes as uint32_t.
+  if (mesh.triVerts.data() != nullptr || numTri == 0) {
+    file.write(reinterpret_cast<const char*>(mesh.triVerts.data()),
+               numTri * sizeof(glm::ivec3));
+  } else {
+    std::vector<glm::ivec3> block(std::min(numTri, kIOChunk));
+    for (int start = 0; start < numTri; start += kIOChunk) {
+      const int end = std::min(numTri, start + kIOChunk);
+      for (int tri = start; tri < end; ++tri)
+        block[tri - start] = mesh.triVerts[tri];
+      file.write(reinterpret_cast<const char*>(block.data()),
+                 (end - start) * sizeof(glm::ivec3));
+    }
+  }
+  ALWAYS_ASSERT(file.good(), userErr, "Failed to write " + filename);
+}
+
+}  // namespace manifold
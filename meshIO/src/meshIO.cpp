@@ -15,20 +15,26 @@
 #include "meshIO.h"
 
 #include <algorithm>
+#include <cctype>
 
 #include "assimp/Exporter.hpp"
 #include "assimp/Importer.hpp"
 #include "assimp/pbrmaterial.h"
 #include "assimp/postprocess.h"
 #include "assimp/scene.h"
+#include "native_io.h"
+#include "parallel.h"
 
-namespace manifold {
+namespace {
 
-Mesh ImportMesh(const std::string& filename) {
+std::string LowerExtension(const std::string& filename) {
   std::string ext = filename.substr(filename.find_last_of(".") + 1);
-  const bool isYup = ext == "glb" || ext == "gltf";
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  return ext;
+}
 
-  Assimp::Importer importer;
+const aiScene* ReadScene(Assimp::Importer& importer,
+                         const std::string& filename, unsigned int flags) {
   importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS,                    //
                               aiComponent_NORMALS |                      //
                                   aiComponent_TANGENTS_AND_BITANGENTS |  //
@@ -43,36 +49,121 @@ Mesh ImportMesh(const std::string& filename) {
   importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE,
                               aiPrimitiveType_POINT | aiPrimitiveType_LINE);
   const aiScene* scene =
-      importer.ReadFile(filename,                             //
-                        aiProcess_JoinIdenticalVertices |     //
-                            aiProcess_Triangulate |           //
-                            aiProcess_RemoveComponent |       //
-                            aiProcess_PreTransformVertices |  //
-                            aiProcess_SortByPType |           //
-                            aiProcess_OptimizeMeshes);
+      importer.ReadFile(filename,                         //
+                        aiProcess_JoinIdenticalVertices |  //
+                            aiProcess_Triangulate |        //
+                            aiProcess_RemoveComponent |    //
+                            aiProcess_SortByPType |        //
+                            flags);
 
   ALWAYS_ASSERT(scene, userErr, importer.GetErrorString());
+  return scene;
+}
+
+void AppendMesh(const aiMesh* mesh_i, bool isYup, const std::string& filename,
+                Mesh& mesh_out) {
+  const int offset = mesh_out.vertPos.size();
+  for (int j = 0; j < mesh_i->mNumVertices; ++j) {
+    const aiVector3D vert = mesh_i->mVertices[j];
+    mesh_out.vertPos.push_back(isYup ? glm::vec3(vert.z, vert.x, vert.y)
+                                     : glm::vec3(vert.x, vert.y, vert.z));
+  }
+  for (int j = 0; j < mesh_i->mNumFaces; ++j) {
+    const aiFace face = mesh_i->mFaces[j];
+    ALWAYS_ASSERT(face.mNumIndices == 3, userErr,
+                  "Non-triangular face in " + filename);
+    mesh_out.triVerts.emplace_back(offset + face.mIndices[0],
+                                   offset + face.mIndices[1],
+                                   offset + face.mIndices[2]);
+  }
+}
+
+/**
+ * Converts a node transform to Manifold's axes, which for Y-up files means
+ * permuting its rows and columns the same way as the verts.
+ */
+glm::mat4x3 ToMat4x3(const aiMatrix4x4& transform, bool isYup) {
+  glm::mat4x3 out;
+  for (const int col : {0, 1, 2, 3}) {
+    for (const int row : {0, 1, 2}) {
+      const int fileRow = isYup ? (row + 2) % 3 : row;
+      const int fileCol = isYup && col < 3 ? (col + 2) % 3 : col;
+      out[col][row] = transform[fileRow][fileCol];
+    }
+  }
+  return out;
+}
+
+void AddInstances(const aiNode* node, aiMatrix4x4 transform, bool isYup,
+                  std::vector<MeshInstance>& instances) {
+  transform = transform * node->mTransformation;
+  for (int i = 0; i < node->mNumMeshes; ++i) {
+    instances.push_back({static_cast<int>(node->mMeshes[i]),
+                         ToMat4x3(transform, isYup)});
+  }
+  for (int i = 0; i < node->mNumChildren; ++i) {
+    AddInstances(node->mChildren[i], transform, isYup, instances);
+  }
+}
+}  // namespace
+
+namespace manifold {
+
+Mesh ImportMesh(const std::string& filename) {
+  const std::string lowerExt = LowerExtension(filename);
+  const bool isYup = lowerExt == "glb" || lowerExt == "gltf";
+  if (lowerExt == "stl") {
+    // Binary STL is a triangle soup, which is faster to weld natively than with
+    // aiProcess_JoinIdenticalVertices. ASCII STL falls through to Assimp.
+    Mesh mesh;
+    if (ImportBinarySTL(filename, mesh)) return mesh;
+  }
+  if (lowerExt == "ply" || lowerExt == "obj") {
+    // Triangle meshes are parsed natively in parallel; anything else, such as
+    // polygonal faces, falls through to Assimp.
+    Mesh mesh;
+    if (lowerExt == "ply" ? ImportPLY(filename, mesh)
+                          : ImportOBJ(filename, mesh))
+      return mesh;
+  }
+
+  Assimp::Importer importer;
+  const aiScene* scene = ReadScene(
+      importer, filename,
+      aiProcess_PreTransformVertices | aiProcess_OptimizeMeshes);
 
   Mesh mesh_out;
   for (int i = 0; i < scene->mNumMeshes; ++i) {
-    const aiMesh* mesh_i = scene->mMeshes[i];
-    for (int j = 0; j < mesh_i->mNumVertices; ++j) {
-      const aiVector3D vert = mesh_i->mVertices[j];
-      mesh_out.vertPos.push_back(isYup ? glm::vec3(vert.z, vert.x, vert.y)
-                                       : glm::vec3(vert.x, vert.y, vert.z));
-    }
-    for (int j = 0; j < mesh_i->mNumFaces; ++j) {
-      const aiFace face = mesh_i->mFaces[j];
-      ALWAYS_ASSERT(face.mNumIndices == 3, userErr,
-                    "Non-triangular face in " + filename);
-      mesh_out.triVerts.emplace_back(face.mIndices[0], face.mIndices[1],
-                                     face.mIndices[2]);
-    }
+    AppendMesh(scene->mMeshes[i], isYup, filename, mesh_out);
   }
   return mesh_out;
 }
 
-void ExportMesh(const std::string& filename, const Mesh& mesh,
+MeshScene ImportMeshes(const std::string& filename) {
+  MeshScene out;
+  const std::string ext = LowerExtension(filename);
+  if (ext == "stl" || ext == "ply") {
+    // These formats hold a single mesh.
+    out.meshes.push_back(ImportMesh(filename));
+    out.instances.push_back({0, glm::mat4x3(1.0f)});
+    return out;
+  }
+
+  // Without aiProcess_PreTransformVertices, each mesh is kept in its own
+  // coordinates and shared by the nodes that reference it.
+  Assimp::Importer importer;
+  const aiScene* scene = ReadScene(importer, filename, 0);
+  const bool isYup = ext == "glb" || ext == "gltf";
+
+  out.meshes.resize(scene->mNumMeshes);
+  ParallelFor(scene->mNumMeshes, [&](int i) {
+    AppendMesh(scene->mMeshes[i], isYup, filename, out.meshes[i]);
+  });
+  AddInstances(scene->mRootNode, aiMatrix4x4(), isYup, out.instances);
+  return out;
+}
+
+void ExportMesh(const std::string& filename, const MeshView& mesh,
                 const ExportOptions& options) {
   if (mesh.triVerts.size() == 0) {
     std::cout << filename << " was not saved because the input mesh was empty."
@@ -80,6 +171,20 @@ void ExportMesh(const std::string& filename, const Mesh& mesh,
     return;
   }
 
+  const std::string lowerExt = LowerExtension(filename);
+  if (lowerExt == "stl") {
+    ExportBinarySTL(filename, mesh);
+    return;
+  }
+  if (lowerExt == "glb") {
+    ExportGLB(filename, mesh, options);
+    return;
+  }
+  if (lowerExt == "3mf") {
+    Export3MF(filename, mesh, options);
+    return;
+  }
+
   std::string ext = filename.substr(filename.find_last_of(".") + 1);
   const bool isYup = ext == "glb" || ext == "gltf";
   if (ext == "glb") ext = "glb2";
@@ -0,0 +1,355 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+#include "native_io.h"
+#include "parallel.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+using namespace manifold;
+
+// Text is parsed in parallel in chunks of about this many bytes.
+constexpr size_t kTextChunk = 1 << 20;
+// The number of hash shards the verts are divided into for welding.
+constexpr int kNumShard = 256;
+
+/**
+ * The bit pattern of a position, with -0 replaced by 0 so that the two weld.
+ */
+glm::uvec3 PositionKey(glm::vec3 pos) {
+  glm::uvec3 key;
+  for (const int i : {0, 1, 2}) {
+    const float x = pos[i] == 0 ? 0.0f : pos[i];
+    std::memcpy(&key[i], &x, sizeof(float));
+  }
+  return key;
+}
+
+uint64_t HashKey(const glm::uvec3& key) {
+  uint64_t hash = key.x;
+  hash = hash * 0x9E3779B97F4A7C15ull + key.y;
+  hash = hash * 0x9E3779B97F4A7C15ull + key.z;
+  return hash ^ (hash >> 29);
+}
+
+struct KeyHash {
+  size_t operator()(const glm::uvec3& key) const { return HashKey(key); }
+};
+
+#ifdef _WIN32
+using Locale = _locale_t;
+#else
+using Locale = locale_t;
+#endif
+
+/**
+ * The "C" locale, created once and shared by all threads, so that numbers are
+ * read and written with a '.' decimal point whatever the global locale is.
+ */
+Locale CLocale() {
+#ifdef _WIN32
+  static const Locale locale = _create_locale(LC_ALL, "C");
+#else
+  static const Locale locale = newlocale(LC_ALL_MASK, "C", Locale(0));
+#endif
+  return locale;
+}
+
+float StrToFloat(const char* str, char** strEnd) {
+#ifdef _WIN32
+  return _strtof_l(str, strEnd, CLocale());
+#else
+  return strtof_l(str, strEnd, CLocale());
+#endif
+}
+}  // namespace
+
+namespace manifold {
+
+MappedFile::MappedFile(const std::string& filename) {
+#ifndef _WIN32
+  const int fd = open(filename.c_str(), O_RDONLY);
+  ALWAYS_ASSERT(fd >= 0, userErr, "Could not open " + filename);
+  struct stat info;
+  const bool statted = fstat(fd, &info) == 0;
+  const bool empty = statted && info.st_size == 0;
+  if (statted && !empty) {
+    void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      data_ = static_cast<const char*>(map);
+      size_ = info.st_size;
+      mapped_ = true;
+    }
+  }
+  close(fd);
+  if (mapped_ || empty) return;
+#endif
+  // Fall back to reading the whole file.
+  std::ifstream file(filename, std::ios::binary);
+  ALWAYS_ASSERT(file.is_open(), userErr, "Could not open " + filename);
+  buffer_.assign(std::istreambuf_iterator<char>(file),
+                 std::istreambuf_iterator<char>());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+ScopedCLocale::ScopedCLocale() {
+#ifdef _WIN32
+  oldMode_ = _configthreadlocale(_ENABLE_PER_THREAD_LOCALE);
+  oldLocale_ = setlocale(LC_ALL, nullptr);
+  setlocale(LC_ALL, "C");
+#else
+  oldLocale_ = uselocale(CLocale());
+#endif
+}
+
+ScopedCLocale::~ScopedCLocale() {
+#ifdef _WIN32
+  setlocale(LC_ALL, oldLocale_.c_str());
+  _configthreadlocale(oldMode_);
+#else
+  uselocale(oldLocale_);
+#endif
+}
+
+/**
+ * Welds identical positions of a triangle soup, filling vertPos with the unique
+ * positions in order of first appearance, and vertIdx, of length soup.size,
+ * with the index into vertPos of each soup position. The verts are bucketed
+ * into hash shards, which are then welded independently in parallel.
+ *
+ * The positions are read straight from soup, which may be a mapped file, and
+ * their keys and shards are recomputed rather than stored, so that the only
+ * temporary of soup size is the bucket array.
+ */
+void WeldVerts(const PackedPositions& soup, int* vertIdx,
+               std::vector<glm::vec3>& vertPos) {
+  const int numSoup = soup.size;
+  const int numChunk = NumIOChunk(numSoup);
+  auto shardOf = [&soup](int i) {
+    return HashKey(PositionKey(soup[i])) >> 56;
+  };
+  std::vector<int> shardCount(numChunk * kNumShard, 0);
+  ParallelFor(numChunk, [&](int chunk) {
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) {
+      ++shardCount[chunk * kNumShard + shardOf(i)];
+    }
+  });
+
+  // Bucket the verts by shard, keeping them in order within each shard.
+  std::vector<int> shardStart(kNumShard + 1, 0);
+  int offset = 0;
+  for (int s = 0; s < kNumShard; ++s) {
+    shardStart[s] = offset;
+    for (int chunk = 0; chunk < numChunk; ++chunk) {
+      const int count = shardCount[chunk * kNumShard + s];
+      shardCount[chunk * kNumShard + s] = offset;
+      offset += count;
+    }
+  }
+  shardStart[kNumShard] = offset;
+
+  std::vector<int> bucket(numSoup);
+  ParallelFor(numChunk, [&](int chunk) {
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) {
+      bucket[shardCount[chunk * kNumShard + shardOf(i)]++] = i;
+    }
+  });
+
+  // Each vert refers to the first vert with the same position.
+  ParallelFor(kNumShard, [&](int s) {
+    std::unordered_map<glm::uvec3, int, KeyHash> firstOfKey;
+    firstOfKey.reserve(shardStart[s + 1] - shardStart[s]);
+    for (int j = shardStart[s]; j < shardStart[s + 1]; ++j) {
+      const int i = bucket[j];
+      vertIdx[i] = firstOfKey.emplace(PositionKey(soup[i]), i).first->second;
+    }
+  });
+  std::vector<int>().swap(bucket);
+
+  // Number the unique verts in order.
+  std::vector<int> chunkStart(numChunk + 1, 0);
+  ParallelFor(numChunk, [&](int chunk) {
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) {
+      if (vertIdx[i] == i) ++chunkStart[chunk + 1];
+    }
+  });
+  for (int chunk = 0; chunk < numChunk; ++chunk) {
+    chunkStart[chunk + 1] += chunkStart[chunk];
+  }
+
+  // The first verts are renumbered in place, stored as ~index to tell them
+  // apart from the others, which then copy their first vert's entry.
+  vertPos.resize(chunkStart[numChunk]);
+  ParallelFor(numChunk, [&](int chunk) {
+    int idx = chunkStart[chunk];
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) {
+      if (vertIdx[i] != i) continue;
+      vertPos[idx] = soup[i];
+      vertIdx[i] = ~idx++;
+    }
+  });
+
+  ParallelFor(numChunk, [&](int chunk) {
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) {
+      if (vertIdx[i] >= 0) vertIdx[i] = vertIdx[vertIdx[i]];
+    }
+  });
+
+  ParallelFor(numChunk, [&](int chunk) {
+    const int end = std::min(numSoup, (chunk + 1) * kIOChunk);
+    for (int i = chunk * kIOChunk; i < end; ++i) vertIdx[i] = ~vertIdx[i];
+  });
+}
+
+/**
+ * Prepares an indexed mesh that was read from filename: checks that its indices
+ * are in range, welds identical positions, and removes unreferenced verts, as
+ * the Assimp import does. The remaining verts keep their relative order.
+ */
+void WeldAndCompact(Mesh& mesh, const std::string& filename) {
+  const int numVert = mesh.vertPos.size();
+  const int numTri = mesh.triVerts.size();
+  std::atomic<bool> inRange(true);
+  ParallelFor(NumIOChunk(numTri), [&](int chunk) {
+    const int end = std::min(numTri, (chunk + 1) * kIOChunk);
+    for (int tri = chunk * kIOChunk; tri < end; ++tri) {
+      for (const int i : {0, 1, 2}) {
+        const int vert = mesh.triVerts[tri][i];
+        if (vert < 0 || vert >= numVert) inRange = false;
+      }
+    }
+  });
+  ALWAYS_ASSERT(inRange, userErr, "Vertex index out of range in " + filename);
+
+  std::vector<glm::vec3> weldedPos;
+  std::vector<int> weldIdx(numVert);
+  WeldVerts({reinterpret_cast<const char*>(mesh.vertPos.data()), numVert},
+            weldIdx.data(), weldedPos);
+  std::vector<uint8_t> used(weldedPos.size(), 0);
+  ParallelFor(NumIOChunk(numTri), [&](int chunk) {
+    const int end = std::min(numTri, (chunk + 1) * kIOChunk);
+    for (int tri = chunk * kIOChunk; tri < end; ++tri) {
+      for (const int i : {0, 1, 2}) {
+        const int vert = weldIdx[mesh.triVerts[tri][i]];
+        mesh.triVerts[tri][i] = vert;
+        used[vert] = 1;
+      }
+    }
+  });
+
+  std::vector<int> newIdx(weldedPos.size());
+  int numUsed = 0;
+  for (int vert = 0; vert < weldedPos.size(); ++vert) {
+    newIdx[vert] = numUsed;
+    if (used[vert]) weldedPos[numUsed++] = weldedPos[vert];
+  }
+  weldedPos.resize(numUsed);
+  mesh.vertPos.swap(weldedPos);
+  if (numUsed == newIdx.size()) return;
+
+  ParallelFor(NumIOChunk(numTri), [&](int chunk) {
+    const int end = std::min(numTri, (chunk + 1) * kIOChunk);
+    for (int tri = chunk * kIOChunk; tri < end; ++tri) {
+      for (const int i : {0, 1, 2}) {
+        mesh.triVerts[tri][i] = newIdx[mesh.triVerts[tri][i]];
+      }
+    }
+  });
+}
+
+/**
+ * Splits text into chunks of roughly kTextChunk bytes for parallel parsing.
+ * Returns the chunk boundaries, including begin and end; each chunk but the
+ * last ends just after a newline.
+ */
+std::vector<const char*> SplitLines(const char* begin, const char* end) {
+  std::vector<const char*> split = {begin};
+  while (end - split.back() > kTextChunk) {
+    const char* start = split.back() + kTextChunk;
+    const char* newline =
+        static_cast<const char*>(std::memchr(start, '\n', end - start));
+    if (newline == nullptr || newline + 1 == end) break;
+    split.push_back(newline + 1);
+  }
+  split.push_back(end);
+  return split;
+}
+
+/**
+ * Parses a number from the whitespace-separated token at p, which must end
+ * before end. Returns the position after the token, or nullptr if it is not a
+ * number. The token is read in the "C" locale, as file formats require.
+ */
+const char* ParseFloat(const char* p, const char* end, float& x) {
+  while (p < end && (*p == ' ' || *p == '\t')) ++p;
+  // The token is copied, as the input is not null-terminated.
+  char token[64];
+  int length = 0;
+  while (p < end && !std::isspace(static_cast<unsigned char>(*p))) {
+    if (length == sizeof(token) - 1) return nullptr;
+    token[length++] = *p++;
+  }
+  if (length == 0) return nullptr;
+  token[length] = '\0';
+  char* tokenEnd;
+  x = StrToFloat(token, &tokenEnd);
+  return tokenEnd == token + length ? p : nullptr;
+}
+
+/**
+ * Parses an integer at p, after any spaces, which must end before end. Returns
+ * the position after the digits, or nullptr if there are none.
+ */
+const char* ParseInt(const char* p, const char* end, int& x) {
+  while (p < end && (*p == ' ' || *p == '\t')) ++p;
+  const bool negative = p < end && *p == '-';
+  if (p < end && (*p == '-' || *p == '+')) ++p;
+  const char* digits = p;
+  int64_t value = 0;
+  while (p < end && *p >= '0' && *p <= '9' && value <= INT32_MAX) {
+    value = 10 * value + (*p++ - '0');
+  }
+  if (p == digits || value > INT32_MAX) return nullptr;
+  x = negative ? -value : value;
+  return p;
+}
+
+}  // namespace manifold
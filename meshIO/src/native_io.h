@@ -0,0 +1,132 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <locale.h>
+#include <string>
+#include <vector>
+
+#include "meshIO.h"
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+namespace manifold {
+
+/** @addtogroup Private
+ *  @{
+ */
+// The number of elements handled by each parallel task.
+constexpr int kIOChunk = 1 << 16;
+
+inline int NumIOChunk(int n) { return (n + kIOChunk - 1) / kIOChunk; }
+
+/**
+ * A read-only view of a whole file. Where available the file is memory-mapped,
+ * so that large inputs are paged in on demand rather than copied.
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<char> buffer_;
+};
+
+/**
+ * A read-only view of positions stored as packed float triples, possibly
+ * unaligned and in fixed-size groups, such as the three verts of each binary
+ * STL triangle. Position i starts groupStride * (i / groupSize) +
+ * sizeof(glm::vec3) * (i % groupSize) bytes after data.
+ */
+struct PackedPositions {
+  const char* data;
+  int size;
+  int groupSize = 1;
+  size_t groupStride = sizeof(glm::vec3);
+
+  glm::vec3 operator[](int i) const {
+    glm::vec3 pos;
+    std::memcpy(&pos,
+                data + groupStride * (i / groupSize) +
+                    sizeof(glm::vec3) * (i % groupSize),
+                sizeof(glm::vec3));
+    return pos;
+  }
+};
+
+/**
+ * Switches the calling thread to the "C" locale for the lifetime of this
+ * object, so that numbers are printed with a '.' decimal point whatever the
+ * global locale is.
+ */
+class ScopedCLocale {
+ public:
+  ScopedCLocale();
+  ~ScopedCLocale();
+  ScopedCLocale(const ScopedCLocale&) = delete;
+  ScopedCLocale& operator=(const ScopedCLocale&) = delete;
+
+ private:
+#ifdef _WIN32
+  int oldMode_;
+  std::string oldLocale_;
+#else
+  locale_t oldLocale_;
+#endif
+};
+
+void WeldVerts(const PackedPositions& soup, int* vertIdx,
+               std::vector<glm::vec3>& vertPos);
+void WeldAndCompact(Mesh& mesh, const std::string& filename);
+
+std::vector<const char*> SplitLines(const char* begin, const char* end);
+const char* ParseFloat(const char* p, const char* end, float& x);
+const char* ParseInt(const char* p, const char* end, int& x);
+
+/**
+ * Calls func(begin, end) for each line in [begin, end), excluding the line
+ * ending. A final line without a line ending is included if it is not empty.
+ */
+template <typename Func>
+void ForEachLine(const char* begin, const char* end, Func func) {
+  while (begin < end) {
+    const char* lineEnd = begin;
+    while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+    func(begin, lineEnd);
+    begin = lineEnd + 1;
+  }
+}
+
+bool ImportBinarySTL(const std::string& filename, Mesh& mesh);
+void ExportBinarySTL(const std::string& filename, const MeshView& mesh);
+void ExportGLB(const std::string& filename, const MeshView& mesh,
+               const ExportOptions& options);
+void Export3MF(const std::string& filename, const MeshView& mesh,
+               const ExportOptions& options);
+bool ImportPLY(const std::string& filename, Mesh& mesh);
+bool ImportOBJ(const std::string& filename, Mesh& mesh);
+/** @} */
+}  // namespace manifold
@@ -0,0 +1,137 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cctype>
+
+#include "native_io.h"
+#include "parallel.h"
+
+namespace {
+using namespace manifold;
+
+enum class ObjLine { VERTEX, FACE, OTHER };
+
+/**
+ * Returns the kind of OBJ statement on this line, advancing p past its
+ * keyword. Only vertex positions and faces are read; normals, texture
+ * coordinates, groups and the rest are skipped.
+ */
+ObjLine Classify(const char*& p, const char* end) {
+  while (p < end && (*p == ' ' || *p == '\t')) ++p;
+  if (end - p < 2 || (p[1] != ' ' && p[1] != '\t')) return ObjLine::OTHER;
+  const char keyword = p[0];
+  p += 1;
+  if (keyword == 'v') return ObjLine::VERTEX;
+  if (keyword == 'f') return ObjLine::FACE;
+  return ObjLine::OTHER;
+}
+
+/**
+ * Parses a face vertex such as 7, -2, 7/1 or 7//3, keeping only the position
+ * index. Negative indices are relative to the numVert vertices above this
+ * line. Returns nullptr if the index is missing or out of range.
+ */
+const char* ParseFaceVert(const char* p, const char* end, int numVert,
+                          int& vert) {
+  p = ParseInt(p, end, vert);
+  if (p == nullptr || vert == 0) return nullptr;
+  vert = vert > 0 ? vert - 1 : numVert + vert;
+  if (vert < 0) return nullptr;
+  while (p < end && !std::isspace(static_cast<unsigned char>(*p))) ++p;
+  return p;
+}
+}  // namespace
+
+namespace manifold {
+
+/**
+ * Reads an OBJ file directly into mesh. The file is parsed in two parallel
+ * passes over chunks of lines: the first counts the vertices and faces in
+ * each chunk so that the second can write them straight to their final
+ * place. Returns false if any face is not a triangle, so that Assimp can be
+ * used instead.
+ */
+bool ImportOBJ(const std::string& filename, Mesh& mesh) {
+  MappedFile file(filename);
+  const std::vector<const char*> split =
+      SplitLines(file.data(), file.data() + file.size());
+  const int numChunk = split.size() - 1;
+
+  std::vector<int> chunkVert(numChunk + 1, 0);
+  std::vector<int> chunkTri(numChunk + 1, 0);
+  ParallelFor(numChunk, [&](int chunk) {
+    ForEachLine(split[chunk], split[chunk + 1],
+                [&](const char* p, const char* lineEnd) {
+                  switch (Classify(p, lineEnd)) {
+                    case ObjLine::VERTEX:
+                      ++chunkVert[chunk + 1];
+                      break;
+                    case ObjLine::FACE:
+                      ++chunkTri[chunk + 1];
+                      break;
+                    default:
+                      break;
+                  }
+                });
+  });
+  for (int chunk = 0; chunk < numChunk; ++chunk) {
+    chunkVert[chunk + 1] += chunkVert[chunk];
+    chunkTri[chunk + 1] += chunkTri[chunk];
+  }
+  if (chunkTri[numChunk] == 0) return false;
+
+  mesh.vertPos.resize(chunkVert[numChunk]);
+  mesh.triVerts.resize(chunkTri[numChunk]);
+  std::atomic<bool> valid(true);
+  ParallelFor(numChunk, [&](int chunk) {
+    int vert = chunkVert[chunk];
+    int tri = chunkTri[chunk];
+    ForEachLine(split[chunk], split[chunk + 1], [&](const char* p,
+                                                    const char* lineEnd) {
+      switch (Classify(p, lineEnd)) {
+        case ObjLine::VERTEX: {
+          glm::vec3& pos = mesh.vertPos[vert++];
+          for (const int i : {0, 1, 2}) {
+            if (p != nullptr) p = ParseFloat(p, lineEnd, pos[i]);
+          }
+          break;
+        }
+        case ObjLine::FACE: {
+          glm::ivec3& triVerts = mesh.triVerts[tri++];
+          for (const int i : {0, 1, 2}) {
+            if (p != nullptr) p = ParseFaceVert(p, lineEnd, vert, triVerts[i]);
+          }
+          if (p == nullptr) break;
+          while (p < lineEnd && std::isspace(static_cast<unsigned char>(*p)))
+            ++p;
+          // Anything else on the line means this face is not a triangle.
+          if (p < lineEnd && *p != '#') p = nullptr;
+          break;
+        }
+        default:
+          break;
+      }
+      if (p == nullptr) valid = false;
+    });
+  });
+  if (!valid) {
+    mesh = Mesh();
+    return false;
+  }
+  WeldAndCompact(mesh, filename);
+  return true;
+}
+
+}  // namespace manifold
@@ -0,0 +1,375 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#include "native_io.h"
+#include "parallel.h"
+
+namespace {
+using namespace manifold;
+
+enum class PlyFormat { ASCII, BINARY_LITTLE_ENDIAN, OTHER };
+
+enum class PlyType {
+  INT8,
+  UINT8,
+  INT16,
+  UINT16,
+  INT32,
+  UINT32,
+  FLOAT32,
+  FLOAT64,
+  NONE
+};
+
+PlyType ParsePlyType(const std::string& name) {
+  if (name == "char" || name == "int8") return PlyType::INT8;
+  if (name == "uchar" || name == "uint8") return PlyType::UINT8;
+  if (name == "short" || name == "int16") return PlyType::INT16;
+  if (name == "ushort" || name == "uint16") return PlyType::UINT16;
+  if (name == "int" || name == "int32") return PlyType::INT32;
+  if (name == "uint" || name == "uint32") return PlyType::UINT32;
+  if (name == "float" || name == "float32") return PlyType::FLOAT32;
+  if (name == "double" || name == "float64") return PlyType::FLOAT64;
+  return PlyType::NONE;
+}
+
+int PlySize(PlyType type) {
+  switch (type) {
+    case PlyType::INT8:
+    case PlyType::UINT8:
+      return 1;
+    case PlyType::INT16:
+    case PlyType::UINT16:
+      return 2;
+    case PlyType::INT32:
+    case PlyType::UINT32:
+    case PlyType::FLOAT32:
+      return 4;
+    case PlyType::FLOAT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+template <typename T>
+T Read(const char* p) {
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+/**
+ * Reads a little-endian binary value in place.
+ */
+double ReadPly(const char* p, PlyType type) {
+  switch (type) {
+    case PlyType::INT8:
+      return Read<int8_t>(p);
+    case PlyType::UINT8:
+      return Read<uint8_t>(p);
+    case PlyType::INT16:
+      return Read<int16_t>(p);
+    case PlyType::UINT16:
+      return Read<uint16_t>(p);
+    case PlyType::INT32:
+      return Read<int32_t>(p);
+    case PlyType::UINT32:
+      return Read<uint32_t>(p);
+    case PlyType::FLOAT32:
+      return Read<float>(p);
+    case PlyType::FLOAT64:
+      return Read<double>(p);
+    default:
+      return 0;
+  }
+}
+
+struct PlyProperty {
+  std::string name;
+  PlyType type;
+  PlyType countType = PlyType::NONE;  // only for list properties
+
+  bool IsList() const { return countType != PlyType::NONE; }
+};
+
+struct PlyElement {
+  std::string name;
+  int count;
+  std::vector<PlyProperty> properties;
+};
+
+/**
+ * The parts of a PLY file that make up a Mesh: the vertex element with its x,
+ * y and z properties, and the face element with its list of vertex indices.
+ */
+struct PlyLayout {
+  PlyFormat format = PlyFormat::OTHER;
+  std::vector<PlyElement> elements;
+  int vertElem = -1;
+  int faceElem = -1;
+  int xyz[3] = {-1, -1, -1};
+  int indexList = -1;
+};
+
+/**
+ * Parses the PLY header, returning the offset of the body, or 0 if the file is
+ * not PLY or has a layout that is not handled natively.
+ */
+size_t ParsePlyHeader(const char* data, size_t size, PlyLayout& layout) {
+  const char kEnd[] = "end_header";
+  const char* headerEnd =
+      std::search(data, data + size, kEnd, kEnd + sizeof(kEnd) - 1);
+  if (size < 3 || std::strncmp(data, "ply", 3) != 0 || headerEnd == data + size)
+    return 0;
+  const char* body = static_cast<const char*>(
+      std::memchr(headerEnd, '\n', data + size - headerEnd));
+  if (body == nullptr) return 0;
+
+  std::istringstream header(std::string(data, headerEnd));
+  std::string line;
+  while (std::getline(header, line)) {
+    std::istringstream words(line);
+    std::string keyword;
+    words >> keyword;
+    if (keyword == "format") {
+      std::string format;
+      words >> format;
+      if (format == "ascii") layout.format = PlyFormat::ASCII;
+      if (format == "binary_little_endian")
+        layout.format = PlyFormat::BINARY_LITTLE_ENDIAN;
+    } else if (keyword == "element") {
+      PlyElement element;
+      words >> element.name >> element.count;
+      if (!words || element.count < 0) return 0;
+      layout.elements.push_back(element);
+    } else if (keyword == "property") {
+      if (layout.elements.empty()) return 0;
+      PlyProperty property;
+      std::string type;
+      words >> type;
+      if (type == "list") {
+        std::string countType;
+        words >> countType >> type;
+        property.countType = ParsePlyType(countType);
+        if (property.countType == PlyType::NONE) return 0;
+      }
+      property.type = ParsePlyType(type);
+      words >> property.name;
+      if (property.type == PlyType::NONE) return 0;
+      layout.elements.back().properties.push_back(property);
+    }
+  }
+  if (layout.format == PlyFormat::OTHER) return 0;
+
+  for (int e = 0; e < layout.elements.size(); ++e) {
+    const PlyElement& element = layout.elements[e];
+    if (element.name == "vertex" && layout.vertElem < 0) {
+      layout.vertElem = e;
+      for (int p = 0; p < element.properties.size(); ++p) {
+        const PlyProperty& property = element.properties[p];
+        if (property.IsList()) return 0;
+        if (property.name == "x") layout.xyz[0] = p;
+        if (property.name == "y") layout.xyz[1] = p;
+        if (property.name == "z") layout.xyz[2] = p;
+      }
+    } else if (element.name == "face" && layout.faceElem < 0) {
+      layout.faceElem = e;
+      for (int p = 0; p < element.properties.size(); ++p) {
+        const PlyProperty& property = element.properties[p];
+        if (!property.IsList()) continue;
+        if (layout.indexList >= 0 || (property.name != "vertex_indices" &&
+                                      property.name != "vertex_index"))
+          return 0;
+        layout.indexList = p;
+      }
+    }
+  }
+  if (layout.vertElem < 0 || layout.faceElem < 0 || layout.indexList < 0 ||
+      layout.xyz[0] < 0 || layout.xyz[1] < 0 || layout.xyz[2] < 0)
+    return 0;
+  return body + 1 - data;
+}
+
+/**
+ * Reads the binary body in place. Faces are assumed to be triangles, which
+ * gives them a fixed size; this returns false if any is not.
+ */
+bool ReadBinaryPly(const char* p, const char* end, const PlyLayout& layout,
+                   Mesh& mesh) {
+  const int lastElem = std::max(layout.vertElem, layout.faceElem);
+  for (int e = 0; e <= lastElem; ++e) {
+    const PlyElement& element = layout.elements[e];
+    std::vector<int> offset;
+    int stride = 0;
+    for (const PlyProperty& property : element.properties) {
+      offset.push_back(stride);
+      if (property.IsList()) {
+        if (e != layout.faceElem) return false;
+        stride += PlySize(property.countType) + 3 * PlySize(property.type);
+      } else {
+        stride += PlySize(property.type);
+      }
+    }
+    if (stride > 0 && (end - p) / stride < element.count) return false;
+
+    if (e == layout.vertElem) {
+      ParallelFor(NumIOChunk(element.count), [&](int chunk) {
+        const int last = std::min(element.count, (chunk + 1) * kIOChunk);
+        for (int vert = chunk * kIOChunk; vert < last; ++vert) {
+          const char* record = p + size_t(stride) * vert;
+          for (const int i : {0, 1, 2}) {
+            const int prop = layout.xyz[i];
+            mesh.vertPos[vert][i] = ReadPly(record + offset[prop],
+                                            element.properties[prop].type);
+          }
+        }
+      });
+    } else if (e == layout.faceElem) {
+      const PlyProperty& list = element.properties[layout.indexList];
+      const int countSize = PlySize(list.countType);
+      const int indexSize = PlySize(list.type);
+      std::atomic<bool> allTriangles(true);
+      ParallelFor(NumIOChunk(element.count), [&](int chunk) {
+        const int last = std::min(element.count, (chunk + 1) * kIOChunk);
+        for (int tri = chunk * kIOChunk; tri < last; ++tri) {
+          const char* record =
+              p + size_t(stride) * tri + offset[layout.indexList];
+          if (ReadPly(record, list.countType) != 3) {
+            allTriangles = false;
+            return;
+          }
+          for (const int i : {0, 1, 2}) {
+            mesh.triVerts[tri][i] =
+                ReadPly(record + countSize + i * indexSize, list.type);
+          }
+        }
+      });
+      if (!allTriangles) return false;
+    }
+    p += size_t(stride) * element.count;
+  }
+  return true;
+}
+
+/**
+ * Parses the ASCII body, where each record is one line. The lines are split
+ * into chunks that are parsed in parallel, after counting the lines of each
+ * chunk to find which element its records belong to.
+ */
+bool ReadAsciiPly(const char* begin, const char* end, const PlyLayout& layout,
+                  Mesh& mesh) {
+  std::vector<int> elemStart(layout.elements.size() + 1, 0);
+  for (int e = 0; e < layout.elements.size(); ++e) {
+    elemStart[e + 1] = elemStart[e] + layout.elements[e].count;
+  }
+
+  const std::vector<const char*> split = SplitLines(begin, end);
+  const int numChunk = split.size() - 1;
+  std::vector<int> chunkLine(numChunk + 1, 0);
+  ParallelFor(numChunk, [&](int chunk) {
+    ForEachLine(split[chunk], split[chunk + 1],
+                [&](const char*, const char*) { ++chunkLine[chunk + 1]; });
+  });
+  for (int chunk = 0; chunk < numChunk; ++chunk) {
+    chunkLine[chunk + 1] += chunkLine[chunk];
+  }
+  if (chunkLine[numChunk] < elemStart[layout.vertElem + 1] ||
+      chunkLine[numChunk] < elemStart[layout.faceElem + 1])
+    return false;
+
+  const PlyElement& vertElem = layout.elements[layout.vertElem];
+  const PlyElement& faceElem = layout.elements[layout.faceElem];
+  std::atomic<bool> valid(true);
+  ParallelFor(numChunk, [&](int chunk) {
+    int line = chunkLine[chunk];
+    ForEachLine(split[chunk], split[chunk + 1], [&](const char* p,
+                                                    const char* lineEnd) {
+      const int record = line++;
+      if (record >= elemStart[layout.vertElem] &&
+          record < elemStart[layout.vertElem + 1]) {
+        const int vert = record - elemStart[layout.vertElem];
+        for (int prop = 0; prop < vertElem.properties.size(); ++prop) {
+          float x;
+          p = ParseFloat(p, lineEnd, x);
+          if (p == nullptr) {
+            valid = false;
+            return;
+          }
+          for (const int i : {0, 1, 2}) {
+            if (prop == layout.xyz[i]) mesh.vertPos[vert][i] = x;
+          }
+        }
+      } else if (record >= elemStart[layout.faceElem] &&
+                 record < elemStart[layout.faceElem + 1]) {
+        const int tri = record - elemStart[layout.faceElem];
+        for (int prop = 0; prop < faceElem.properties.size(); ++prop) {
+          if (prop != layout.indexList) {
+            float unused;
+            p = ParseFloat(p, lineEnd, unused);
+          } else {
+            int count = 0;
+            p = ParseInt(p, lineEnd, count);
+            for (const int i : {0, 1, 2}) {
+              if (p != nullptr) p = ParseInt(p, lineEnd, mesh.triVerts[tri][i]);
+            }
+            if (count != 3) p = nullptr;
+          }
+          if (p == nullptr) {
+            valid = false;
+            return;
+          }
+        }
+      }
+    });
+  });
+  return valid;
+}
+}  // namespace
+
+namespace manifold {
+
+/**
+ * Reads a PLY file directly into mesh. Returns false if the file uses
+ * features that are not handled natively, such as big-endian data or faces
+ * that are not triangles, so that Assimp can be used instead.
+ */
+bool ImportPLY(const std::string& filename, Mesh& mesh) {
+  MappedFile file(filename);
+  PlyLayout layout;
+  const size_t body = ParsePlyHeader(file.data(), file.size(), layout);
+  if (body == 0) return false;
+
+  mesh.vertPos.resize(layout.elements[layout.vertElem].count);
+  mesh.triVerts.resize(layout.elements[layout.faceElem].count);
+  const char* begin = file.data() + body;
+  const char* end = file.data() + file.size();
+  const bool read = layout.format == PlyFormat::ASCII
+                        ? ReadAsciiPly(begin, end, layout, mesh)
+                        : ReadBinaryPly(begin, end, layout, mesh);
+  if (!read) {
+    mesh = Mesh();
+    return false;
+  }
+  WeldAndCompact(mesh, filename);
+  return true;
+}
+
+}  // namespace manifold
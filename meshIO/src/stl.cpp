@@ -0,0 +1,93 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "native_io.h"
+
+namespace {
+using namespace manifold;
+
+constexpr int kHeaderBytes = 80;
+constexpr int kTriBytes = 50;
+}  // namespace
+
+namespace manifold {
+
+/**
+ * Reads a binary STL file directly into mesh, welding identical vertices.
+ * Returns false without changing mesh if the file is not binary STL, which
+ * is detected by its size matching its triangle count.
+ */
+bool ImportBinarySTL(const std::string& filename, Mesh& mesh) {
+  MappedFile file(filename);
+  if (file.size() < kHeaderBytes + sizeof(uint32_t)) return false;
+  uint32_t numTri;
+  std::memcpy(&numTri, file.data() + kHeaderBytes, sizeof(uint32_t));
+  const char* tris = file.data() + kHeaderBytes + sizeof(uint32_t);
+  if (file.size() != tris - file.data() + size_t(kTriBytes) * numTri)
+    return false;
+
+  ALWAYS_ASSERT(numTri <= INT32_MAX / 3, userErr,
+                "Too many triangles in " + filename);
+
+  // Each triangle is a normal, three verts, and a two-byte attribute. The
+  // verts are welded straight from the file, writing their indices directly
+  // into triVerts.
+  mesh.triVerts.resize(numTri);
+  const PackedPositions soup = {tris + 3 * sizeof(float), int(3 * numTri), 3,
+                                kTriBytes};
+  WeldVerts(soup, reinterpret_cast<int*>(mesh.triVerts.data()), mesh.vertPos);
+  return true;
+}
+
+/**
+ * Writes mesh as binary STL, streaming the triangles out in blocks.
+ */
+void ExportBinarySTL(const std::string& filename, const MeshView& mesh) {
+  std::ofstream file(filename, std::ios::binary);
+  ALWAYS_ASSERT(file.is_open(), userErr,
+                "Could not open " + filename + " for writing.");
+
+  char header[kHeaderBytes] = "Binary STL written by Manifold";
+  file.write(header, kHeaderBytes);
+  const uint32_t numTri = mesh.triVerts.size();
+  file.write(reinterpret_cast<const char*>(&numTri), sizeof(uint32_t));
+
+  std::vector<char> buffer(size_t(kTriBytes) * kIOChunk, 0);
+  for (int start = 0; start < numTri; start += kIOChunk) {
+    const int end = std::min<int>(numTri, start + kIOChunk);
+    char* out = buffer.data();
+    for (int tri = start; tri < end; ++tri) {
+      glm::vec3 v[3];
+      for (const int i : {0, 1, 2}) v[i] = mesh.vertPos[mesh.triVerts[tri][i]];
+      glm::vec3 normal = glm::cross(v[1] - v[0], v[2] - v[0]);
+      const float length = glm::length(normal);
+      normal = length > 0 ? normal / length : glm::vec3(0.0f);
+      std::memcpy(out, &normal, 3 * sizeof(float));
+      out += 3 * sizeof(float);
+      for (const int i : {0, 1, 2}) {
+        std::memcpy(out, &v[i], 3 * sizeof(float));
+        out += 3 * sizeof(float);
+      }
+      out += sizeof(uint16_t);  // attribute byte count, left zero
+    }
+    file.write(buffer.data(), out - buffer.data());
+  }
+  ALWAYS_ASSERT(file.good(), userErr, "Failed to write " + filename);
+}
+
+}  // namespace manifold
@@ -24,6 +24,9 @@ namespace manifold {
  */
 std::vector<glm::ivec3> Triangulate(const Polygons &polys,
                                     float precision = -1);
+std::vector<glm::ivec3> TriangulateBatch(const std::vector<Polygons> &polys,
+                                         const std::vector<float> &precisions,
+                                         std::vector<int> &triOffset);
 
 std::vector<Halfedge> Polygons2Edges(const Polygons &polys);
 std::vector<Halfedge> Triangles2Edges(const std::vector<glm::ivec3> &triangles);
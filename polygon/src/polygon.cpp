@@ -17,24 +17,178 @@
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
-#include <list>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stack>
+#include <vector>
+
+#include "parallel.h"
 
 namespace {
 using namespace manifold;
 
 ExecutionParams params;
 
+// The number of polygons triangulated by each task of TriangulateBatch.
+constexpr int kBatchGrain = 64;
+// Strictly convex polygons up to this size are triangulated as a fan instead of
+// going through the sweep.
+constexpr int kMaxFanVerts = 32;
+
+/**
+ * A doubly-linked list with the same interface and iterator stability as
+ * std::list, but whose nodes are stored contiguously in a Pool. Several lists
+ * may share a Pool, which allows nodes to be spliced between them. Iterators
+ * are indices into the Pool, so they remain valid as it grows, and a Pool that
+ * is cleared keeps its capacity, so it can be reused without allocating.
+ */
+template <typename T>
+class PoolList {
+ public:
+  struct Node {
+    T value;
+    int prev, next;
+  };
+
+  class Pool {
+   public:
+    Pool &Clear() {
+      nodes_.clear();
+      free_.clear();
+      return *this;
+    }
+
+   private:
+    friend class PoolList;
+    std::vector<Node> nodes_;
+    std::vector<int> free_;
+
+    int Alloc(const T &value) {
+      // The value is copied first, as it may reference a node in this Pool.
+      Node node = {value, -1, -1};
+      if (free_.empty()) {
+        nodes_.push_back(node);
+        return nodes_.size() - 1;
+      }
+      const int idx = free_.back();
+      free_.pop_back();
+      nodes_[idx] = node;
+      return idx;
+    }
+  };
+
+  class Itr {
+   public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T *pointer;
+    typedef T &reference;
+
+    Itr() {}
+    T &operator*() const { return pool_->nodes_[idx_].value; }
+    T *operator->() const { return &pool_->nodes_[idx_].value; }
+    Itr &operator++() {
+      idx_ = pool_->nodes_[idx_].next;
+      return *this;
+    }
+    Itr operator++(int) {
+      Itr old = *this;
+      ++*this;
+      return old;
+    }
+    Itr &operator--() {
+      idx_ = pool_->nodes_[idx_].prev;
+      return *this;
+    }
+    Itr operator--(int) {
+      Itr old = *this;
+      --*this;
+      return old;
+    }
+    bool operator==(const Itr &other) const { return idx_ == other.idx_; }
+    bool operator!=(const Itr &other) const { return idx_ != other.idx_; }
+
+   private:
+    friend class PoolList;
+    Itr(Pool *pool, int idx) : pool_(pool), idx_(idx) {}
+    Pool *pool_ = nullptr;
+    int idx_ = -1;
+  };
+
+  explicit PoolList(Pool &pool) : pool_(&pool), sentinel_(pool.Alloc(T())) {
+    Node &sentinel = pool_->nodes_[sentinel_];
+    sentinel.prev = sentinel_;
+    sentinel.next = sentinel_;
+  }
+
+  Itr begin() const { return Itr(pool_, pool_->nodes_[sentinel_].next); }
+  Itr end() const { return Itr(pool_, sentinel_); }
+  int size() const { return size_; }
+
+  Itr insert(Itr pos, const T &value) {
+    const int idx = pool_->Alloc(value);
+    Link(idx, pos.idx_);
+    ++size_;
+    return Itr(pool_, idx);
+  }
+
+  void push_back(const T &value) { insert(end(), value); }
+
+  void erase(Itr it) {
+    Unlink(it.idx_);
+    pool_->free_.push_back(it.idx_);
+    --size_;
+  }
+
+  /**
+   * Moves the node at it from other, which must share this list's Pool, to
+   * just before pos.
+   */
+  void splice(Itr pos, PoolList &other, Itr it) {
+    if (pos == it) return;
+    other.Unlink(it.idx_);
+    --other.size_;
+    Link(it.idx_, pos.idx_);
+    ++size_;
+  }
+
+ private:
+  Pool *pool_;
+  int sentinel_;
+  int size_ = 0;
+
+  void Link(int idx, int before) {
+    std::vector<Node> &nodes = pool_->nodes_;
+    const int prev = nodes[before].prev;
+    nodes[idx].prev = prev;
+    nodes[idx].next = before;
+    nodes[prev].next = idx;
+    nodes[before].prev = idx;
+  }
+
+  void Unlink(int idx) {
+    std::vector<Node> &nodes = pool_->nodes_;
+    const Node &node = nodes[idx];
+    nodes[node.prev].next = node.next;
+    nodes[node.next].prev = node.prev;
+  }
+};
+
 /**
  * The class first turns input polygons into monotone polygons, then
  * triangulates them using the above class.
  */
 class Monotones {
  public:
-  Monotones(const Polygons &polys, float precision) : precision_(precision) {
+  Monotones(const Polygons &polys, float precision)
+      : monotones_(pools_->verts),
+        activePairs_(pools_->pairs),
+        inactivePairs_(pools_->pairs),
+        precision_(precision) {
     VertItr start, last, current;
     float bound = 0;
     for (const SimplePolygon &poly : polys) {
@@ -100,8 +254,9 @@ class Monotones {
       ALWAYS_ASSERT(triangulator.NumTriangles() > 0, topologyErr,
                     "Monotone produced no triangles.");
       triangles_left -= 2 + triangulator.NumTriangles();
-      // Find next monotone
-      start = std::find_if(monotones_.begin(), monotones_.end(),
+      // Find next monotone. All verts before start have been processed, so
+      // the search resumes from there, keeping this pass linear.
+      start = std::find_if(start, monotones_.end(),
                            [](const VertAdj &v) { return !v.Processed(); });
     }
     ALWAYS_ASSERT(triangles_left == 0, topologyErr,
@@ -134,7 +289,7 @@ class Monotones {
           v = v->right;
         }
         std::cout << std::endl;
-        start = std::find_if(monotones_.begin(), monotones_.end(),
+        start = std::find_if(start, monotones_.end(),
                              [](const VertAdj &v) { return !v.Processed(); });
       }
     }
@@ -142,14 +297,49 @@ class Monotones {
 
  private:
   struct VertAdj;
-  typedef std::list<VertAdj>::iterator VertItr;
+  typedef PoolList<VertAdj>::Itr VertItr;
   struct EdgePair;
-  typedef std::list<EdgePair>::iterator PairItr;
+  typedef PoolList<EdgePair>::Itr PairItr;
   enum VertType { START, WESTSIDE, EASTSIDE, MERGE, END, SKIP };
+  struct Pools;
 
-  std::list<VertAdj> monotones_;     // sweep-line list of verts
-  std::list<EdgePair> activePairs_;  // west to east list of monotone edge pairs
-  std::list<EdgePair> inactivePairs_;  // completed monotones
+  /**
+   * Takes a Pools from the calling thread's free-list, or makes one if it is
+   * empty, and returns it on destruction. Each live Monotones thus has its own
+   * Pools, so constructing one never clears the nodes of another.
+   */
+  class PoolLease {
+   public:
+    PoolLease() {
+      std::vector<std::unique_ptr<Pools>> &freePools = FreePools();
+      if (freePools.empty()) {
+        pools_.reset(new Pools());
+      } else {
+        pools_ = std::move(freePools.back());
+        freePools.pop_back();
+        pools_->verts.Clear();
+        pools_->pairs.Clear();
+      }
+    }
+    ~PoolLease() { FreePools().push_back(std::move(pools_)); }
+    PoolLease(const PoolLease &) = delete;
+    PoolLease &operator=(const PoolLease &) = delete;
+
+    Pools *operator->() const { return pools_.get(); }
+
+   private:
+    std::unique_ptr<Pools> pools_;
+
+    static std::vector<std::unique_ptr<Pools>> &FreePools() {
+      static thread_local std::vector<std::unique_ptr<Pools>> freePools;
+      return freePools;
+    }
+  };
+
+  PoolLease pools_;                 // must precede the lists that use it
+  PoolList<VertAdj> monotones_;     // sweep-line list of verts
+  PoolList<EdgePair> activePairs_;  // west to east list of monotone edge pairs
+  PoolList<EdgePair> inactivePairs_;  // completed monotones
   float precision_;  // a triangle of this height or less is degenerate
 
   /**
@@ -285,7 +475,7 @@ class Monotones {
     }
 
    private:
-    std::stack<VertItr> reflex_chain_;
+    std::stack<VertItr, std::vector<VertItr>> reflex_chain_;
     VertItr other_side_;  // The end vertex across from the reflex chain
     bool onRight_;        // The side the reflex chain is on
     int triangles_output_ = 0;
@@ -300,6 +490,13 @@ class Monotones {
     }
   };
 
+  // Triangulate is called for every face of every Boolean result, so the
+  // nodes are kept in per-thread pools whose storage is reused between calls.
+  struct Pools {
+    PoolList<VertAdj>::Pool verts;
+    PoolList<EdgePair>::Pool pairs;
+  };
+
   void Link(VertItr left, VertItr right) {
     left->right = right;
     right->left = left;
@@ -796,17 +993,98 @@ class Monotones {
 };  // namespace
 
 void PrintFailure(const std::exception &e, const Polygons &polys,
-                  std::vector<glm::ivec3> &triangles) {
+                  const std::vector<glm::ivec3> &triangles, int startTri) {
   std::cout << "-----------------------------------" << std::endl;
   std::cout << "Triangulation failed!" << std::endl;
   std::cout << e.what() << std::endl;
   Dump(polys);
   std::cout << "produced this triangulation:" << std::endl;
-  for (int j = 0; j < triangles.size(); ++j) {
+  for (int j = startTri; j < triangles.size(); ++j) {
     std::cout << triangles[j][0] << ", " << triangles[j][1] << ", "
               << triangles[j][2] << std::endl;
   }
 }
+
+/**
+ * Returns the sign of x, or last if x is zero, for counting sign changes.
+ */
+int SignOr(float x, int last) { return x > 0 ? 1 : x < 0 ? -1 : last; }
+
+/**
+ * If poly is strictly convex within precision, this appends a fan triangulation
+ * of it to triangles and returns true. Every vert must turn left, and the edge
+ * directions must change sign at most twice in each of x and y, which rules out
+ * polygons that wind around more than once.
+ */
+bool TriangulateConvex(const SimplePolygon &poly, float precision,
+                       std::vector<glm::ivec3> &triangles) {
+  const int n = poly.size();
+  if (n < 3) return false;
+  if (precision < 0) {
+    float bound = 0;
+    for (const PolyVert &vert : poly) {
+      bound = glm::max(bound, glm::max(glm::abs(vert.pos.x),
+                                       glm::abs(vert.pos.y)));
+    }
+    precision = bound * kTolerance;
+  }
+
+  glm::vec2 edge = poly[0].pos - poly[n - 1].pos;
+  int xSign = SignOr(edge.x, 0);
+  int ySign = SignOr(edge.y, 0);
+  int xFlips = 0;
+  int yFlips = 0;
+  for (int i = 0; i < n; ++i) {
+    const glm::vec2 next = poly[i + 1 < n ? i + 1 : 0].pos;
+    if (CCW(poly[i].pos - edge, poly[i].pos, next, precision) != 1)
+      return false;
+    edge = next - poly[i].pos;
+    const int x = SignOr(edge.x, xSign);
+    const int y = SignOr(edge.y, ySign);
+    if (x * xSign < 0) ++xFlips;
+    if (y * ySign < 0) ++yFlips;
+    xSign = x;
+    ySign = y;
+  }
+  if (xFlips > 2 || yFlips > 2) return false;
+
+  for (int i = 2; i < n; ++i) {
+    triangles.emplace_back(poly[0].idx, poly[i - 1].idx, poly[i].idx);
+  }
+  return true;
+}
+
+/**
+ * Triangulates polys, appending the result to triangles, so that a batch can
+ * share one output buffer.
+ */
+void AppendTriangulation(const Polygons &polys, float precision,
+                         std::vector<glm::ivec3> &triangles) {
+  const int startTri = triangles.size();
+  try {
+    // Most faces of a Boolean result are small and convex, so they are checked
+    // for a fan triangulation first.
+    if (polys.size() != 1 || polys[0].size() > kMaxFanVerts ||
+        !TriangulateConvex(polys[0], precision, triangles)) {
+      Monotones monotones(polys, precision);
+      monotones.Triangulate(triangles);
+    }
+    if (params.intermediateChecks) {
+      const std::vector<glm::ivec3> newTris(triangles.begin() + startTri,
+                                            triangles.end());
+      CheckTopology(newTris, polys);
+      CheckGeometry(newTris, polys, precision);
+    }
+  } catch (const geometryErr &e) {
+    if (!params.suppressErrors) {
+      PrintFailure(e, polys, triangles, startTri);
+    }
+    throw;
+  } catch (const std::exception &e) {
+    PrintFailure(e, polys, triangles, startTri);
+    throw;
+  }
+}
 }  // namespace
 
 namespace manifold {
@@ -823,21 +1101,53 @@ namespace manifold {
  */
 std::vector<glm::ivec3> Triangulate(const Polygons &polys, float precision) {
   std::vector<glm::ivec3> triangles;
-  try {
-    Monotones monotones(polys, precision);
-    monotones.Triangulate(triangles);
-    if (params.intermediateChecks) {
-      CheckTopology(triangles, polys);
-      CheckGeometry(triangles, polys, precision);
-    }
-  } catch (const geometryErr &e) {
-    if (!params.suppressErrors) {
-      PrintFailure(e, polys, triangles);
+  AppendTriangulation(polys, precision, triangles);
+  return triangles;
+}
+
+/**
+ * @brief Triangulates many independent sets of polygons in parallel.
+ *
+ * @param polys Each element is a set of polygons as input to Triangulate().
+ * @param precisions The precision for each set of polygons, or empty to
+ * calculate them all automatically.
+ * @param triOffset Output of length polys.size() + 1, where the triangles of
+ * polys[i] are in the range [triOffset[i], triOffset[i + 1]) of the result.
+ * @return std::vector<glm::ivec3> The triangles of all the polygons,
+ * concatenated in order.
+ */
+std::vector<glm::ivec3> TriangulateBatch(const std::vector<Polygons> &polys,
+                                         const std::vector<float> &precisions,
+                                         std::vector<int> &triOffset) {
+  const int numPoly = polys.size();
+  ALWAYS_ASSERT(precisions.empty() || precisions.size() == numPoly, userErr,
+                "precisions must be empty or match the number of polygons.");
+  // Each task triangulates a contiguous range of polygons into its own buffer,
+  // recording the offsets relative to that buffer.
+  const int numTask = (numPoly + kBatchGrain - 1) / kBatchGrain;
+  std::vector<std::vector<glm::ivec3>> taskTris(numTask);
+  triOffset.assign(numPoly + 1, 0);
+  ParallelFor(numTask, [&](int task) {
+    std::vector<glm::ivec3> &triangles = taskTris[task];
+    const int end = std::min(numPoly, (task + 1) * kBatchGrain);
+    for (int i = task * kBatchGrain; i < end; ++i) {
+      AppendTriangulation(polys[i], precisions.empty() ? -1 : precisions[i],
+                          triangles);
+      triOffset[i + 1] = triangles.size();
     }
-    throw;
-  } catch (const std::exception &e) {
-    PrintFailure(e, polys, triangles);
-    throw;
+  });
+
+  int numTri = 0;
+  for (int task = 0; task < numTask; ++task) {
+    const int end = std::min(numPoly, (task + 1) * kBatchGrain);
+    for (int i = task * kBatchGrain; i < end; ++i) triOffset[i + 1] += numTri;
+    numTri += taskTris[task].size();
+  }
+
+  std::vector<glm::ivec3> triangles;
+  triangles.reserve(numTri);
+  for (const auto &tris : taskTris) {
+    triangles.insert(triangles.end(), tris.begin(), tris.end());
   }
   return triangles;
 }
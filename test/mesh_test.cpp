@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <fstream>
 #include <random>
 
 #include "gtest/gtest.h"
 #include "manifold.h"
 #include "meshIO.h"
+#include "parallel.h"
 #include "polygon.h"
 
 namespace {
@@ -133,6 +135,82 @@ TEST(MeshIO, ReadWrite) {
   Identical(mesh, mesh_out);
 }
 
+TEST(MeshIO, BinarySTL) {
+  Mesh mesh = ImportMesh("data/gyroidpuzzle.ply");
+  ExportMesh("data/gyroidpuzzle1.stl", mesh, {});
+  Mesh mesh_out = ImportMesh("data/gyroidpuzzle1.stl");
+  // STL stores positions per triangle, so the welded verts may be numbered
+  // differently, but each triangle must have the same positions.
+  ASSERT_EQ(mesh_out.vertPos.size(), mesh.vertPos.size());
+  ASSERT_EQ(mesh_out.triVerts.size(), mesh.triVerts.size());
+  for (int tri = 0; tri < mesh.triVerts.size(); ++tri) {
+    for (int i : {0, 1, 2}) {
+      ASSERT_EQ(mesh_out.vertPos[mesh_out.triVerts[tri][i]],
+                mesh.vertPos[mesh.triVerts[tri][i]]);
+    }
+  }
+  EXPECT_TRUE(Manifold(mesh_out).IsManifold());
+}
+
+TEST(MeshIO, GLBAnd3MF) {
+  Mesh mesh = Manifold::Sphere(1).GetMesh();
+  ExportOptions options;
+  options.faceted = false;
+  options.mat.vertColor.resize(mesh.vertPos.size(), glm::vec4(1, 0, 0, 1));
+  for (const std::string filename : {"data/sphere.glb", "data/sphere.3mf"}) {
+    ExportMesh(filename, mesh, options);
+    Mesh mesh_out = ImportMesh(filename);
+    ASSERT_EQ(mesh_out.triVerts.size(), mesh.triVerts.size());
+    EXPECT_TRUE(Manifold(mesh_out).IsManifold());
+    EXPECT_NEAR(Manifold(mesh_out).GetProperties().volume,
+                Manifold(mesh).GetProperties().volume, 0.0001);
+  }
+}
+
+TEST(MeshIO, OBJ) {
+  // Only positions are kept, whether indexed absolutely or relative to the
+  // preceding vertices, and the duplicate vertex is welded.
+  std::ofstream obj("data/tetrahedron.obj");
+  obj << "# tetrahedron\n"
+         "v -1 -1 1\nv -1 1 -1\nv 1 -1 -1\n"
+         "vn 0 0 1\n"
+         "f 1/1/1 2//1 3\n"
+         "v 1 1 1\nv 1 1 1\n"
+         "f 1 4 2\n"
+         "f -4 -1 -3\n"
+         "f 1 3 4 # last\n";
+  obj.close();
+  Mesh mesh = ImportMesh("data/tetrahedron.obj");
+  ASSERT_EQ(mesh.vertPos.size(), 4);
+  ASSERT_EQ(mesh.triVerts.size(), 4);
+  EXPECT_EQ(mesh.triVerts[0], glm::ivec3(0, 1, 2));
+  EXPECT_EQ(mesh.triVerts[2], glm::ivec3(1, 3, 2));
+  EXPECT_TRUE(Manifold(mesh).IsManifold());
+}
+
+TEST(MeshIO, ImportMeshes) {
+  std::ofstream obj("data/tetrahedra.obj");
+  obj << "v -1 -1 1\nv -1 1 -1\nv 1 -1 -1\nv 1 1 1\n"
+         "v 4 -1 1\nv 4 1 -1\nv 6 -1 -1\nv 6 1 1\n"
+         "o first\nf 1 2 3\nf 1 4 2\nf 2 4 3\nf 1 3 4\n"
+         "o second\nf 5 6 7\nf 5 8 6\nf 6 8 7\nf 5 7 8\n";
+  obj.close();
+  MeshScene scene = ImportMeshes("data/tetrahedra.obj");
+  ASSERT_EQ(scene.meshes.size(), 2);
+  ASSERT_EQ(scene.instances.size(), 2);
+
+  std::vector<Manifold> parts(scene.meshes.size());
+  ParallelFor(parts.size(),
+              [&](int i) { parts[i] = Manifold(scene.meshes[i]); });
+  for (const MeshInstance& instance : scene.instances) {
+    Manifold part = parts[instance.meshIdx];
+    part.Transform(instance.transform);
+    EXPECT_TRUE(part.IsManifold());
+    EXPECT_EQ(part.NumTri(), 4);
+  }
+  EXPECT_NE(parts[0].GetMeshIDs()[0], parts[1].GetMeshIDs()[0]);
+}
+
 /**
  * This tests that turning a mesh into a manifold and returning it to a mesh
  * produces a consistent result.
@@ -145,6 +223,117 @@ TEST(Manifold, GetMesh) {
   Identical(mesh_out, mesh_out2);
 }
 
+TEST(Manifold, GetMeshView) {
+  Manifold manifold = Manifold::Sphere(1);
+  manifold.Translate(glm::vec3(1, 2, 3));
+  const Mesh mesh = manifold.GetMesh();
+  const MeshView view = manifold.GetMeshView();
+  ASSERT_EQ(view.vertPos.size(), mesh.vertPos.size());
+  ASSERT_EQ(view.vertNormal.size(), mesh.vertNormal.size());
+  ASSERT_EQ(view.triVerts.size(), mesh.triVerts.size());
+  for (int i = 0; i < mesh.vertPos.size(); ++i) {
+    EXPECT_EQ(view.vertPos[i], mesh.vertPos[i]);
+    EXPECT_EQ(view.vertNormal[i], mesh.vertNormal[i]);
+  }
+  for (int i = 0; i < mesh.triVerts.size(); ++i) {
+    EXPECT_EQ(view.triVerts[i], mesh.triVerts[i]);
+  }
+}
+
+TEST(Manifold, MoveAndViewConstructors) {
+  const Mesh mesh = Manifold::Sphere(1).GetMesh();
+  Manifold fromView(VecView<glm::vec3>(mesh.vertPos),
+                    VecView<glm::ivec3>(mesh.triVerts));
+  EXPECT_TRUE(fromView.IsManifold());
+  Identical(fromView.GetMesh(), Manifold(mesh).GetMesh());
+
+  Mesh moved = mesh;
+  Manifold fromMove(std::move(moved));
+  EXPECT_TRUE(fromMove.IsManifold());
+  EXPECT_TRUE(moved.vertPos.empty());
+  EXPECT_TRUE(moved.triVerts.empty());
+  Identical(fromMove.GetMesh(), fromView.GetMesh());
+}
+
+TEST(Manifold, MergeVerts) {
+  const Mesh sphere = Manifold::Sphere(1).GetMesh();
+  Mesh soup;
+  for (const glm::ivec3& tri : sphere.triVerts) {
+    for (int i : {0, 1, 2}) {
+      soup.vertPos.push_back(sphere.vertPos[tri[i]] +
+                             glm::vec3(1e-6f * (soup.vertPos.size() % 3)));
+    }
+    const int first = soup.vertPos.size() - 3;
+    soup.triVerts.push_back({first, first + 1, first + 2});
+  }
+  MergeVerts(soup, 1e-4f);
+  EXPECT_EQ(soup.vertPos.size(), sphere.vertPos.size());
+  EXPECT_EQ(soup.triVerts.size(), sphere.triVerts.size());
+  Manifold welded(soup);
+  EXPECT_TRUE(welded.IsManifold());
+  EXPECT_EQ(welded.NumVert(), sphere.vertPos.size());
+}
+
+/**
+ * This tests that a serialized manifold reloads with the same geometry and a
+ * working collider, under new meshIDs.
+ */
+TEST(Manifold, Serialize) {
+  Manifold manifold = Manifold::Sphere(1) - Manifold::Cube(glm::vec3(1));
+  manifold.Translate(glm::vec3(0.5f));
+  std::stringstream stream;
+  manifold.Serialize(stream);
+  const std::string data = stream.str();
+
+  Manifold loaded = Manifold::Deserialize(stream);
+  EXPECT_TRUE(loaded.IsManifold());
+  Identical(manifold.GetMesh(), loaded.GetMesh());
+  EXPECT_FLOAT_EQ(loaded.Precision(), manifold.Precision());
+
+  const Manifold cube = Manifold::Cube(glm::vec3(1), true);
+  EXPECT_EQ(loaded.NumOverlaps(cube), manifold.NumOverlaps(cube));
+  EXPECT_EQ((loaded ^ cube).NumTri(), (manifold ^ cube).NumTri());
+
+  std::vector<int> meshIDs = manifold.GetMeshIDs();
+  std::vector<int> loadedIDs = loaded.GetMeshIDs();
+  ASSERT_EQ(loadedIDs.size(), meshIDs.size());
+  EXPECT_GT(loadedIDs[0], meshIDs.back());
+
+  std::stringstream truncated(data.substr(0, data.size() / 2));
+  EXPECT_THROW(Manifold::Deserialize(truncated), userErr);
+
+  // Point the first halfedge at a vert that does not exist.
+  std::string corrupt = data;
+  const int badVert = manifold.NumVert();
+  const size_t firstHalfedge = 2 * sizeof(uint32_t) + sizeof(Box) +
+                               sizeof(float) +
+                               2 * (sizeof(uint64_t) + sizeof(uint32_t)) +
+                               manifold.NumVert() * sizeof(glm::vec3);
+  corrupt.replace(firstHalfedge, sizeof(int),
+                  reinterpret_cast<const char*>(&badVert), sizeof(int));
+  std::stringstream corrupted(corrupt);
+  EXPECT_THROW(Manifold::Deserialize(corrupted), userErr);
+
+  // Make the collider's root its own first child, a cycle whose indices are
+  // all in range. Its node boxes are the only array of Boxes, so they are found
+  // by their size and element size.
+  corrupt = data;
+  const uint64_t numNode = 2 * manifold.NumTri() - 1;
+  const uint32_t boxSize = sizeof(Box);
+  std::string boxHeader(reinterpret_cast<const char*>(&numNode),
+                        sizeof(uint64_t));
+  boxHeader.append(reinterpret_cast<const char*>(&boxSize), sizeof(uint32_t));
+  const size_t nodeBBox = corrupt.rfind(boxHeader);
+  ASSERT_NE(nodeBBox, std::string::npos);
+  const size_t rootChildren = nodeBBox + 3 * boxHeader.size() +
+                              numNode * (sizeof(Box) + sizeof(int));
+  const int root = 1;
+  corrupt.replace(rootChildren, sizeof(int),
+                  reinterpret_cast<const char*>(&root), sizeof(int));
+  std::stringstream cyclic(corrupt);
+  EXPECT_THROW(Manifold::Deserialize(cyclic), userErr);
+}
+
 TEST(Manifold, Regression) {
   Manifold manifold(ImportMesh("data/gyroidpuzzle.ply"));
   EXPECT_TRUE(manifold.IsManifold());
@@ -196,6 +385,20 @@ TEST(Manifold, Sphere) {
   EXPECT_EQ(sphere.NumTri(), n * n * 8);
 }
 
+/**
+ * This sphere has enough triangles to use 63-bit Morton codes.
+ */
+TEST(Manifold, LargeSphere) {
+  int n = 192;
+  Manifold sphere = Manifold::Sphere(1.0f, 4 * n);
+  EXPECT_TRUE(sphere.IsManifold());
+  EXPECT_EQ(sphere.NumTri(), n * n * 8);
+
+  Manifold octant = sphere ^ Manifold::Cube();
+  CheckStrictly(octant);
+  EXPECT_NEAR(octant.GetProperties().volume, glm::pi<float>() / 6, 0.001);
+}
+
 TEST(Manifold, Normals) {
   Mesh cube = Manifold::Cube(glm::vec3(1), true).GetMesh();
   const int nVert = cube.vertPos.size();
@@ -424,6 +627,36 @@ TEST(Manifold, Transform) {
   Identical(cube.GetMesh(), cube2.GetMesh());
 }
 
+TEST(Manifold, WarpBatch) {
+  auto stretch = [](glm::vec3& v) { v.x += v.z * v.z; };
+  Manifold sphere = Manifold::Sphere(1, 200);
+  Manifold warped = sphere;
+  sphere.Warp(stretch);
+  warped.Warp([stretch](glm::vec3* vertPos, size_t n) {
+    for (size_t i = 0; i < n; ++i) stretch(vertPos[i]);
+  });
+  CheckStrictly(warped);
+  Identical(sphere.GetMesh(), warped.GetMesh());
+}
+
+/**
+ * A large warp degrades the collider enough that it gets rebuilt, which must
+ * give the same collisions as a fresh manifold.
+ */
+TEST(Manifold, WarpCollider) {
+  Manifold twisted = Manifold::Cylinder(10, 1, 1, 64).Refine(4);
+  twisted.Warp([](glm::vec3& v) {
+    const float angle = glm::radians(36.0f * v.z);
+    const float c = glm::cos(angle);
+    const float s = glm::sin(angle);
+    v = glm::vec3(c * v.x - s * v.y + 0.1f * v.z * v.z, s * v.x + c * v.y, v.z);
+  });
+  Manifold fresh(twisted.GetMesh());
+  Manifold other = Manifold::Sphere(3, 32).Translate({2, 0, 5});
+  EXPECT_EQ(twisted.NumOverlaps(other), fresh.NumOverlaps(other));
+  CheckStrictly(twisted - other);
+}
+
 TEST(Manifold, MeshRelation) {
   std::vector<Mesh> input;
   std::map<int, int> meshID2idx;
@@ -709,6 +942,113 @@ TEST(Boolean, Sphere) {
   RelatedOp(sphere, sphere2, result);
 }
 
+/**
+ * A small cut into a large model only queries the patch of faces around it,
+ * while the rest of the model is kept whole.
+ */
+TEST(Boolean, LocalCut) {
+  Manifold sphere = Manifold::Sphere(1.0f, 128);
+  Manifold cube = Manifold::Cube(glm::vec3(0.1f), true);
+  cube.Translate(glm::vec3(1.0f, 0.0f, 0.0f));
+  Manifold result = sphere - cube;
+
+  EXPECT_TRUE(result.IsManifold());
+  EXPECT_TRUE(result.MatchesTriNormals());
+  EXPECT_EQ(result.NumDegenerateTris(), 0);
+  const float volume = sphere.GetProperties().volume;
+  EXPECT_LT(result.GetProperties().volume, volume);
+  EXPECT_GT(result.GetProperties().volume, volume - 0.001f);
+}
+
+TEST(Boolean, EditSession) {
+  const Manifold stock = Manifold::Sphere(1.0f, 64);
+  Manifold expected = stock;
+  EditSession session(stock);
+  int numCodedByOperators = 0;
+  for (int i = 0; i < 8; ++i) {
+    Manifold tool = Manifold::Cube(glm::vec3(0.2f), true);
+    const float z = 0.1f * i - 0.35f;
+    const float r = glm::sqrt(1 - z * z);
+    tool.Rotate(0, 0, 45.0f * i)
+        .Translate(
+            glm::vec3(r * glm::cos(0.25f * i), r * glm::sin(0.25f * i), z));
+    expected -= tool;
+    session -= tool;
+    numCodedByOperators += expected.NumTri();
+  }
+  // Each cut is small, so the session should only code the faces near it.
+  EXPECT_GT(session.NumFacesCoded(), 0);
+  EXPECT_LT(session.NumFacesCoded(), numCodedByOperators / 4);
+  Manifold result = session.Commit();
+
+  EXPECT_TRUE(result.IsManifold());
+  EXPECT_TRUE(result.MatchesTriNormals());
+  EXPECT_EQ(result.NumVert(), expected.NumVert());
+  EXPECT_EQ(result.NumTri(), expected.NumTri());
+  EXPECT_NEAR(result.GetProperties().volume, expected.GetProperties().volume,
+              1e-5);
+}
+
+TEST(Boolean, Intersects) {
+  const Manifold cube = Manifold::Cube(glm::vec3(1.0f), true);
+  Manifold overlap = cube;
+  overlap.Translate(glm::vec3(0.5f, 0.3f, 0.2f));
+  EXPECT_TRUE(cube.Intersects(overlap));
+  EXPECT_TRUE(overlap.Intersects(cube));
+
+  Manifold inside = Manifold::Cube(glm::vec3(0.2f), true);
+  EXPECT_TRUE(cube.Intersects(inside));
+  EXPECT_TRUE(inside.Intersects(cube));
+
+  Manifold touching = cube;
+  touching.Translate(glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_FALSE(cube.Intersects(touching));
+
+  Manifold apart = cube;
+  apart.Translate(glm::vec3(2.0f, 0.5f, 0.0f));
+  EXPECT_FALSE(cube.Intersects(apart));
+  EXPECT_FALSE(cube.Intersects(Manifold()));
+
+  // Edges crossing faces with no vertex of either inside the other.
+  Manifold cross = Manifold::Cube(glm::vec3(3.0f, 0.5f, 0.5f), true);
+  EXPECT_TRUE(cube.Intersects(cross));
+  EXPECT_TRUE(cross.Intersects(cube));
+}
+
+TEST(Boolean, IntersectionProperties) {
+  const Manifold sphere = Manifold::Sphere(1.0f, 32);
+  Manifold cube = Manifold::Cube(glm::vec3(1.0f));
+  cube.Rotate(10, 20, 30);
+  for (Manifold::OpType op :
+       {Manifold::OpType::ADD, Manifold::OpType::SUBTRACT,
+        Manifold::OpType::INTERSECT}) {
+    const Properties fast = sphere.IntersectionProperties(cube, op);
+    const Properties full = sphere.Boolean(cube, op).GetProperties();
+    EXPECT_NEAR(fast.volume, full.volume, 1e-4);
+    EXPECT_NEAR(fast.surfaceArea, full.surfaceArea, 1e-4);
+  }
+
+  cube.Translate(glm::vec3(3.0f));
+  const Properties apart = sphere.IntersectionProperties(cube);
+  EXPECT_FLOAT_EQ(apart.volume, 0.0f);
+  EXPECT_FLOAT_EQ(apart.surfaceArea, 0.0f);
+}
+
+TEST(Boolean, HilbertOrdering) {
+  Manifold::SetOrdering(Manifold::Ordering::HILBERT);
+  Manifold sphere = Manifold::Sphere(1.0f, 12);
+  Manifold sphere2 = sphere;
+  sphere2.Translate(glm::vec3(0.5));
+  sphere2.SetAsOriginal();
+  Manifold result = sphere - sphere2;
+  Manifold::SetOrdering(Manifold::Ordering::MORTON);
+
+  ExpectMeshes(result, {{74, 144}});
+  EXPECT_EQ(result.NumDegenerateTris(), 0);
+
+  RelatedOp(sphere, sphere2, result);
+}
+
 TEST(Boolean, Gyroid) {
   Mesh gyroidpuzzle = ImportMesh("data/gyroidpuzzle.ply");
   Manifold gyroid(gyroidpuzzle);
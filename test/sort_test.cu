@@ -0,0 +1,88 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sort_permutation.cuh"
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace manifold;
+
+/**
+ * Checks SortPermutation against a full sort_by_key of the same codes. The
+ * codes must be unique, so that the expected permutation is too.
+ */
+void CheckSortPermutation(const std::vector<uint32_t>& input) {
+  VecDH<uint32_t> code(input);
+  VecDH<int> new2Old;
+  EXPECT_TRUE(SortPermutation(code, new2Old));
+
+  VecDH<uint32_t> expectedCode(input);
+  VecDH<int> expectedNew2Old(input.size());
+  thrust::sequence(expectedNew2Old.beginD(), expectedNew2Old.endD());
+  thrust::sort_by_key(expectedCode.beginD(), expectedCode.endD(),
+                      expectedNew2Old.beginD());
+
+  ASSERT_EQ(new2Old.size(), input.size());
+  for (int i = 0; i < input.size(); ++i) {
+    ASSERT_EQ(code.H()[i], expectedCode.H()[i]);
+    ASSERT_EQ(new2Old.H()[i], expectedNew2Old.H()[i]);
+  }
+}
+
+std::vector<uint32_t> SortedCodes(int n) {
+  std::vector<uint32_t> codes(n);
+  for (int i = 0; i < n; ++i) codes[i] = 4 * i + 2;
+  return codes;
+}
+}  // namespace
+
+TEST(Sort, SortPermutationSorted) {
+  VecDH<uint32_t> code(SortedCodes(1000));
+  VecDH<int> new2Old(7);
+  EXPECT_FALSE(SortPermutation(code, new2Old));
+  EXPECT_EQ(new2Old.size(), 0);
+}
+
+/**
+ * A few codes out of order take the partial sort and merge path.
+ */
+TEST(Sort, SortPermutationMerge) {
+  std::vector<uint32_t> codes = SortedCodes(1000);
+  // Moved up past some neighbors, down past others, and next to a neighbor.
+  codes[10] = codes[60] + 1;
+  codes[500] = codes[450] + 1;
+  codes[800] = codes[801] + 1;
+  CheckSortPermutation(codes);
+
+  // Codes appended after a sorted run, as when new faces are added.
+  codes = SortedCodes(1000);
+  std::mt19937 gen(12345);
+  std::shuffle(codes.end() - 50, codes.end(), gen);
+  for (int i = 950; i < 1000; ++i) codes[i] -= 4 * 50 + 1;
+  CheckSortPermutation(codes);
+}
+
+/**
+ * Too many codes out of order fall back to a full sort.
+ */
+TEST(Sort, SortPermutationFull) {
+  std::vector<uint32_t> codes = SortedCodes(1000);
+  std::mt19937 gen(12345);
+  std::shuffle(codes.begin(), codes.end(), gen);
+  CheckSortPermutation(codes);
+}
@@ -20,15 +20,25 @@
 using namespace manifold;
 
 int main(int argc, char **argv) {
-  for (int i = 0; i < 8; ++i) {
-    Manifold sphere = Manifold::Sphere(1, (8 << i) * 4);
-    Manifold sphere2 = sphere;
-    sphere2.Translate(glm::vec3(0.5));
-    auto start = std::chrono::high_resolution_clock::now();
-    Manifold diff = sphere - sphere2;
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> elapsed = end - start;
-    std::cout << "nTri = " << sphere.NumTri() << ", time = " << elapsed.count()
-              << " sec" << std::endl;
+  for (Manifold::Ordering ordering :
+       {Manifold::Ordering::MORTON, Manifold::Ordering::HILBERT}) {
+    Manifold::SetOrdering(ordering);
+    std::cout << (ordering == Manifold::Ordering::MORTON ? "Morton" : "Hilbert")
+              << " ordering:" << std::endl;
+    for (int i = 0; i < 8; ++i) {
+      Manifold sphere = Manifold::Sphere(1, (8 << i) * 4);
+      Manifold sphere2 = sphere;
+      sphere2.Translate(glm::vec3(0.5));
+      auto start = std::chrono::high_resolution_clock::now();
+      sphere.NumOverlaps(sphere2);
+      auto mid = std::chrono::high_resolution_clock::now();
+      Manifold diff = sphere - sphere2;
+      auto end = std::chrono::high_resolution_clock::now();
+      std::chrono::duration<double> collide = mid - start;
+      std::chrono::duration<double> elapsed = end - mid;
+      std::cout << "nTri = " << sphere.NumTri()
+                << ", collide = " << collide.count()
+                << " sec, time = " << elapsed.count() << " sec" << std::endl;
+    }
   }
 }
@@ -0,0 +1,126 @@
+// Copyright 2020 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "polygon.h"
+#include "polygon_corpus.h"
+
+using namespace manifold;
+
+namespace {
+
+/**
+ * A circle of n verts, which has a single monotone but a long sweep.
+ */
+Polygons Circle(int n) {
+  Polygons polys(1);
+  for (int i = 0; i < n; ++i) {
+    const float angle = 2 * glm::pi<float>() * i / n;
+    polys[0].push_back({glm::vec2(cos(angle), sin(angle)), i});
+  }
+  return polys;
+}
+
+/**
+ * A long, thin strip whose top edge zigzags within tolerance of its bottom,
+ * so that nearly every vert is degenerate.
+ */
+Polygons Sliver(int n) {
+  Polygons polys(1);
+  for (int i = 0; i <= n; ++i) {
+    polys[0].push_back({glm::vec2(i, 0), i});
+  }
+  for (int i = 0; i <= n; ++i) {
+    const float y = (i % 2 == 0 ? 1 : 2) * n * kTolerance;
+    polys[0].push_back({glm::vec2(n - i, y), n + 1 + i});
+  }
+  return polys;
+}
+
+int NumVert(const Polygons &polys) {
+  int numVert = 0;
+  for (const SimplePolygon &poly : polys) numVert += poly.size();
+  return numVert;
+}
+
+/**
+ * Triangulates polys repeatedly for at least kMinTime and returns the average
+ * time in seconds.
+ */
+double TimeTriangulate(const Polygons &polys) {
+  constexpr double kMinTime = 0.01;
+  int reps = 0;
+  std::chrono::duration<double> elapsed(0);
+  auto start = std::chrono::high_resolution_clock::now();
+  while (elapsed.count() < kMinTime) {
+    Triangulate(polys);
+    ++reps;
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+  }
+  return elapsed.count() / reps;
+}
+
+struct Throughput {
+  int numVert = 0;
+  double time = 0;
+
+  void Add(const std::string &name, const Polygons &polys) {
+    const int n = NumVert(polys);
+    const double t = TimeTriangulate(polys);
+    numVert += n;
+    time += t;
+    std::cout << std::setw(28) << std::left << name << " nVert = " << n
+              << ", time = " << t << " sec, " << n / t << " verts/sec"
+              << std::endl;
+  }
+
+  void Print(const std::string &name) const {
+    std::cout << name << ": nVert = " << numVert << ", time = " << time
+              << " sec, " << numVert / time << " verts/sec" << std::endl
+              << std::endl;
+  }
+};
+}  // namespace
+
+int main() {
+  Throughput corpus;
+  for (const auto &test : polygon_corpus::PolygonCorpus()) {
+    corpus.Add(test.first, test.second);
+  }
+  corpus.Print("Test corpus");
+
+  Throughput circles;
+  for (int n = 1 << 10; n <= 1 << 20; n <<= 2) {
+    circles.Add("Circle " + std::to_string(n), Circle(n));
+  }
+  circles.Print("Circles");
+
+  Throughput plates;
+  for (int n = 4; n <= 256; n <<= 1) {
+    plates.Add("Holes " + std::to_string(n * n),
+               polygon_corpus::DrilledPlate(n));
+  }
+  plates.Print("Drilled plates");
+
+  Throughput slivers;
+  for (int n = 1 << 8; n <= 1 << 16; n <<= 2) {
+    slivers.Add("Sliver " + std::to_string(n), Sliver(n));
+  }
+  slivers.Print("Slivers");
+}
@@ -0,0 +1,154 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace manifold {
+
+/** @addtogroup Private
+ *  @{
+ */
+/**
+ * A fixed set of host worker threads that live for the whole program, so that
+ * frequent parallel calls pay no thread startup and any thread_local scratch
+ * storage is kept between calls.
+ */
+class ThreadPool {
+ public:
+  static ThreadPool& Get() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  /**
+   * Runs job on every worker and on the calling thread, returning once all
+   * have finished; job must not throw. Returns false without running anything
+   * if the pool is in use by another caller or this is called from one of its
+   * workers, so nested and concurrent callers run serially instead of waiting
+   * or oversubscribing the machine.
+   */
+  bool Run(const std::function<void()>& job) {
+    if (workers_.empty() || IsWorker()) return false;
+    std::unique_lock<std::mutex> busy(runMutex_, std::try_to_lock);
+    if (!busy.owns_lock()) return false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      running_ = workers_.size();
+      ++generation_;
+    }
+    start_.notify_all();
+    job();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return running_ == 0; });
+    job_ = nullptr;
+    return true;
+  }
+
+ private:
+  std::vector<std::thread> workers_;
+  std::mutex runMutex_;
+  std::mutex mutex_;
+  std::condition_variable start_, done_;
+  const std::function<void()>* job_ = nullptr;
+  int running_ = 0;
+  int generation_ = 0;
+  bool stop_ = false;
+
+  ThreadPool() {
+    const int numWorker = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    for (int i = 0; i < numWorker; ++i) {
+      workers_.emplace_back([this]() { Work(); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (std::thread& worker : workers_) worker.join();
+  }
+
+  static bool& IsWorker() {
+    static thread_local bool isWorker = false;
+    return isWorker;
+  }
+
+  void Work() {
+    IsWorker() = true;
+    int generation = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+      if (stop_) return;
+      generation = generation_;
+      const std::function<void()>& job = *job_;
+      lock.unlock();
+      job();
+      lock.lock();
+      if (--running_ == 0) done_.notify_one();
+    }
+  }
+};
+
+/**
+ * Calls func(task) for each task in [0, numTask) on a set of host threads, for
+ * work that cannot go through Thrust, such as code that allocates. Tasks are
+ * handed out dynamically, so they may vary in cost. If any task throws, the
+ * remaining tasks are skipped and the first exception is rethrown once all
+ * threads have finished.
+ *
+ * When compiled with OpenMP, the threads of its runtime are used, so as not to
+ * compete with the OMP backend; otherwise those of the ThreadPool. Either way
+ * the threads persist between calls.
+ */
+template <typename Func>
+void ParallelFor(int numTask, Func func) {
+  std::atomic<int> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto worker = [&]() {
+    try {
+      for (int task = next++; task < numTask; task = next++) func(task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error) error = std::current_exception();
+      next = numTask;
+    }
+  };
+
+  if (numTask > 1) {
+#ifdef _OPENMP
+#pragma omp parallel
+    worker();
+#else
+    if (!ThreadPool::Get().Run(worker)) worker();
+#endif
+  } else {
+    worker();
+  }
+  if (error) std::rethrow_exception(error);
+}
+/** @} */
+}  // namespace manifold
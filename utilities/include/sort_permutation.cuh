@@ -0,0 +1,101 @@
+// Copyright 2021 Emmett Lalish
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include "structs.h"
+#include "utils.cuh"
+#include "vec_dh.cuh"
+
+namespace manifold {
+
+/** @addtogroup Private
+ *  @{
+ */
+// If more than this fraction of the codes are out of order, a full sort is
+// faster than sorting them separately and merging.
+constexpr float kMaxMergeFraction = 0.25f;
+
+template <typename T>
+struct InOrder {
+  __host__ __device__ int operator()(thrust::tuple<T, T, T> in) {
+    const T code = thrust::get<0>(in);
+    return code == thrust::get<1>(in) && code == thrust::get<2>(in);
+  }
+};
+
+/**
+ * Sorts the codes, filling new2Old with the resulting permutation. If the codes
+ * are already sorted, this returns false and new2Old is left empty, so the
+ * permutation can be skipped entirely. Codes that are mostly in order, such as
+ * from concatenated sorted inputs or sorted data with some new elements
+ * appended, are sorted by separating out the elements that are out of order,
+ * sorting only those, and merging them back in.
+ */
+template <typename T>
+bool SortPermutation(VecDH<T>& code, VecDH<int>& new2Old) {
+  new2Old.resize(0);
+  if (thrust::is_sorted(code.beginD(), code.endD())) return false;
+
+  const int n = code.size();
+  new2Old.resize(n);
+  thrust::sequence(new2Old.beginD(), new2Old.endD());
+
+  // An element is in order if it is no less than any element before it and no
+  // greater than any after it. Together these form a sorted subsequence.
+  VecDH<T> prefixMax(n);
+  VecDH<T> suffixMin(n);
+  thrust::inclusive_scan(code.beginD(), code.endD(), prefixMax.beginD(),
+                         thrust::maximum<T>());
+  thrust::inclusive_scan(thrust::make_reverse_iterator(code.endD()),
+                         thrust::make_reverse_iterator(code.beginD()),
+                         thrust::make_reverse_iterator(suffixMin.endD()),
+                         thrust::minimum<T>());
+  VecDH<int> inOrder(n);
+  thrust::transform(
+      zip(code.beginD(), prefixMax.beginD(), suffixMin.beginD()),
+      zip(code.endD(), prefixMax.endD(), suffixMin.endD()), inOrder.beginD(),
+      InOrder<T>());
+
+  const int numInOrder =
+      thrust::stable_partition(zip(code.beginD(), new2Old.beginD()),
+                               zip(code.endD(), new2Old.endD()),
+                               inOrder.beginD(), thrust::identity<int>()) -
+      zip(code.beginD(), new2Old.beginD());
+
+  if (n - numInOrder > kMaxMergeFraction * n) {
+    thrust::sort_by_key(code.beginD(), code.endD(), new2Old.beginD());
+    return true;
+  }
+
+  thrust::sort_by_key(code.beginD() + numInOrder, code.endD(),
+                      new2Old.beginD() + numInOrder);
+  VecDH<T> sortedCode(n);
+  VecDH<int> sortedNew2Old(n);
+  thrust::merge_by_key(code.beginD(), code.beginD() + numInOrder,
+                       code.beginD() + numInOrder, code.endD(),
+                       new2Old.beginD(), new2Old.beginD() + numInOrder,
+                       sortedCode.beginD(), sortedNew2Old.beginD());
+  code.swap(sortedCode);
+  new2Old.swap(sortedNew2Old);
+  return true;
+}
+/** @} */
+}  // namespace manifold
@@ -163,6 +163,74 @@ struct Mesh {
   std::vector<glm::vec4> halfedgeTangent;
 };
 
+/**
+ * A read-only view of a contiguous array owned by the caller, such as a
+ * std::vector or a buffer from another library.
+ */
+template <typename T>
+struct VecView {
+  VecView() {}
+  VecView(const T* ptr, size_t size) : ptr_(ptr), size_(size) {}
+  VecView(const std::vector<T>& vec) : ptr_(vec.data()), size_(vec.size()) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const T* data() const { return ptr_; }
+  const T& operator[](size_t i) const { return ptr_[i]; }
+  const T* begin() const { return ptr_; }
+  const T* end() const { return ptr_ + size_; }
+
+ private:
+  const T* ptr_ = nullptr;
+  size_t size_ = 0;
+};
+
+/**
+ * A read-only view of triangle vertex indices. These are either a contiguous
+ * array of glm::ivec3, or are strided through a larger struct, such as the
+ * startVert of each of three consecutive Halfedges.
+ */
+struct TriView {
+  TriView() {}
+  TriView(const int* first, int stride, size_t size)
+      : first_(first), stride_(stride), size_(size) {}
+  TriView(const std::vector<glm::ivec3>& triVerts)
+      : first_(reinterpret_cast<const int*>(triVerts.data())),
+        size_(triVerts.size()) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  /** Returns the indices as a flat int array, or nullptr if strided. */
+  const int* data() const { return stride_ == 1 ? first_ : nullptr; }
+  glm::ivec3 operator[](size_t tri) const {
+    const int* vert = first_ + 3 * stride_ * tri;
+    return glm::ivec3(vert[0], vert[stride_], vert[2 * stride_]);
+  }
+
+ private:
+  const int* first_ = nullptr;
+  int stride_ = 1;
+  size_t size_ = 0;
+};
+
+/**
+ * A read-only counterpart of Mesh that references arrays owned elsewhere,
+ * either by a Mesh or by a Manifold, see Manifold::GetMeshView().
+ */
+struct MeshView {
+  VecView<glm::vec3> vertPos;
+  VecView<glm::vec3> vertNormal;
+  TriView triVerts;
+  VecView<glm::vec4> halfedgeTangent;
+
+  MeshView() {}
+  MeshView(const Mesh& mesh)
+      : vertPos(mesh.vertPos),
+        vertNormal(mesh.vertNormal),
+        triVerts(mesh.triVerts),
+        halfedgeTangent(mesh.halfedgeTangent) {}
+};
+
 struct Smoothness {
   int halfedge;
   float smoothness;
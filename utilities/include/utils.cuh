@@ -20,6 +20,7 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 
+#include <atomic>
 #include <iostream>
 
 namespace manifold {
@@ -116,6 +117,67 @@ __host__ __device__ T AtomicAdd(T& target, T add) {
 #endif
 }
 
+#if !defined(__CUDA_ARCH__) && !defined(__GNUC__)
+/**
+ * Views a plain value as an atomic for compilers without the GCC builtins;
+ * the standard atomics of the supported compilers share the layout of T.
+ */
+template <typename T>
+std::atomic<T>& AsAtomic(T& target) {
+  static_assert(sizeof(std::atomic<T>) == sizeof(T),
+                "Atomic type must match the layout of the plain type.");
+  return reinterpret_cast<std::atomic<T>&>(target);
+}
+#endif
+
+/**
+ * Sets target to val if it equals compare, returning its previous value.
+ */
+template <typename T>
+__host__ __device__ T AtomicCAS(T& target, T compare, T val) {
+#ifdef __CUDA_ARCH__
+  return atomicCAS(&target, compare, val);
+#elif defined(__GNUC__)
+  // On failure, compare is overwritten with the current value.
+  __atomic_compare_exchange_n(&target, &compare, val, false, __ATOMIC_SEQ_CST,
+                              __ATOMIC_SEQ_CST);
+  return compare;
+#else
+  AsAtomic(target).compare_exchange_strong(compare, val);
+  return compare;
+#endif
+}
+
+/**
+ * Reads target while other threads may be writing it. No ordering is implied;
+ * this only guarantees a whole value that some thread actually wrote.
+ */
+template <typename T>
+__host__ __device__ T AtomicLoad(T& target) {
+#ifdef __CUDA_ARCH__
+  return *static_cast<volatile T*>(&target);
+#elif defined(__GNUC__)
+  return __atomic_load_n(&target, __ATOMIC_RELAXED);
+#else
+  return AsAtomic(target).load(std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * Writes target while other threads may be reading or writing it, with the
+ * same relaxed guarantee as AtomicLoad.
+ */
+template <typename T>
+__host__ __device__ void AtomicStore(T& target, T val) {
+#ifdef __CUDA_ARCH__
+  *static_cast<volatile T*>(&target) = val;
+#elif defined(__GNUC__)
+  __atomic_store_n(&target, val, __ATOMIC_RELAXED);
+#else
+  AsAtomic(target).store(val, std::memory_order_relaxed);
+#endif
+}
+
 // Copied from
 // https://github.com/thrust/thrust/blob/master/examples/strided_range.cu
 template <typename Iterator>
@@ -16,6 +16,13 @@
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <iostream>
+
+#include "structs.h"
+
 namespace manifold {
 
 /** @addtogroup Private
@@ -48,6 +55,11 @@ class VecDH {
     device_valid_ = false;
   }
 
+  VecDH(const T* begin, const T* end) {
+    host_.assign(begin, end);
+    device_valid_ = false;
+  }
+
   int size() const { return device_valid_ ? device_.size() : host_.size(); }
 
   void resize(int newSize, T val = T()) {
@@ -200,5 +212,75 @@ class VecD {
   T const* const ptr_;
   const int size_;
 };
+/**
+ * Writes a trivially copyable value in native byte order, for binary
+ * serialization.
+ */
+template <typename T>
+void WriteValue(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void ReadValue(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  ALWAYS_ASSERT(!stream.fail(), userErr, "Serialized data is truncated.");
+}
+
+/**
+ * Writes the array's size and element size, followed by its raw host data. The
+ * element size guards against reading data written with a different memory
+ * layout.
+ */
+template <typename T>
+void WriteVec(std::ostream& stream, const VecDH<T>& vec) {
+  const uint64_t size = vec.size();
+  const uint32_t elementSize = sizeof(T);
+  WriteValue(stream, size);
+  WriteValue(stream, elementSize);
+  if (size > 0)
+    stream.write(reinterpret_cast<const char*>(vec.cptrH()), size * sizeof(T));
+}
+
+/**
+ * Reads an array written by WriteVec straight into host memory; it is copied
+ * to the device only when first used there. A corrupt size must not cause a
+ * huge allocation, so it is checked against the rest of the stream when that
+ * is known, and otherwise the data is read in blocks, allocating only as much
+ * as has actually been read.
+ */
+template <typename T>
+void ReadVec(std::istream& stream, VecDH<T>& vec) {
+  uint64_t size;
+  uint32_t elementSize;
+  ReadValue(stream, size);
+  ReadValue(stream, elementSize);
+  ALWAYS_ASSERT(elementSize == sizeof(T), userErr,
+                "Serialized data has a different memory layout.");
+  ALWAYS_ASSERT(size <= INT_MAX, userErr, "Serialized array is too large.");
+
+  uint64_t block = (1 << 20) / sizeof(T) + 1;
+  const std::streampos start = stream.tellg();
+  if (start != std::streampos(-1)) {
+    stream.seekg(0, std::ios::end);
+    const std::streamoff remaining = stream.tellg() - start;
+    stream.seekg(start);
+    ALWAYS_ASSERT(!stream.fail() && remaining >= 0 &&
+                      size * sizeof(T) <= static_cast<uint64_t>(remaining),
+                  userErr, "Serialized data is truncated.");
+    block = size;
+  }
+
+  vec = VecDH<T>();
+  VecH<T>& host = vec.H();
+  while (host.size() < size) {
+    const uint64_t numRead = host.size();
+    const uint64_t count = std::min(block, size - numRead);
+    host.resize(numRead + count);
+    stream.read(reinterpret_cast<char*>(host.data() + numRead),
+                count * sizeof(T));
+    ALWAYS_ASSERT(!stream.fail(), userErr, "Serialized data is truncated.");
+  }
+}
 /** @} */
 }  // namespace manifold
\ No newline at end of file